@@ -26,8 +26,7 @@
 
 // Function to read a CIFAR-10 batch file
 static int read_cifar10_batch(const char* filename, 
-                             unsigned char** features, 
-                             unsigned char* labels, 
+                             Dataset* dataset, 
                              int offset, 
                              int max_images) {
     FILE* file = fopen(filename, "rb");
@@ -44,24 +43,12 @@ static int read_cifar10_batch(const char* filename,
     while (images_read < max_images && 
            fread(buffer, sizeof(unsigned char), 3073, file) == 3073) {
         // Extract label (first byte)
-        labels[offset + images_read] = buffer[0];
+        dataset->labels[offset + images_read] = buffer[0];
         
         // Extract image data (next 3072 bytes)
         // Each image is in format [R(1024) + G(1024) + B(1024)]
-        // Convert to grayscale or keep as RGB depending on need
-        
-        // Allocate memory for image data if not already done
-        if (features[offset + images_read] == NULL) {
-            features[offset + images_read] = (unsigned char*)malloc(CIFAR10_IMAGE_SIZE * sizeof(unsigned char));
-            if (!features[offset + images_read]) {
-                printf("Error: Failed to allocate memory for image %d\n", offset + images_read);
-                fclose(file);
-                return images_read;
-            }
-        }
-        
         // Copy image data (keeping RGB format)
-        memcpy(features[offset + images_read], buffer + 1, CIFAR10_IMAGE_SIZE);
+        memcpy(dataset_sample(dataset, offset + images_read), buffer + 1, CIFAR10_IMAGE_SIZE);
         
         images_read++;
     }
@@ -79,7 +66,7 @@ Dataset* load_cifar10_dataset(const char* data_dir, const char* is_test) {
     int num_samples = is_training ? 50000 : 10000;
     
     // Allocate dataset structure
-    dataset = (Dataset*)malloc(sizeof(Dataset));
+    dataset = (Dataset*)calloc(1, sizeof(Dataset));
     if (!dataset) {
         printf("Failed to allocate memory for dataset\n");
         return NULL;
@@ -92,24 +79,16 @@ Dataset* load_cifar10_dataset(const char* data_dir, const char* is_test) {
     dataset->feature_dimension = CIFAR10_IMAGE_SIZE;
     dataset->number_of_samples = num_samples;
     
-    // Allocate memory for features and labels
-    dataset->features = (unsigned char**)malloc(num_samples * sizeof(unsigned char*));
-    if (!dataset->features) {
-        printf("Failed to allocate memory for features\n");
-        free(dataset);
+    // Allocate the feature matrix in one block, plus the labels
+    if (!alloc_dataset_features(dataset, num_samples, CIFAR10_IMAGE_SIZE)) {
+        free_dataset(dataset);
         return NULL;
     }
     
-    // Initialize feature pointers to NULL
-    for (int i = 0; i < num_samples; i++) {
-        dataset->features[i] = NULL;
-    }
-    
     dataset->labels = (unsigned char*)malloc(num_samples * sizeof(unsigned char));
     if (!dataset->labels) {
         printf("Failed to allocate memory for labels\n");
-        free(dataset->features);
-        free(dataset);
+        free_dataset(dataset);
         return NULL;
     }
     
@@ -123,8 +102,7 @@ Dataset* load_cifar10_dataset(const char* data_dir, const char* is_test) {
             sprintf(filepath, "%s/%s%d.bin", data_dir, CIFAR10_TRAIN_BATCH_PREFIX, batch);
             printf("Loading training batch %d from %s\n", batch, filepath);
             
-            int batch_images = read_cifar10_batch(filepath, dataset->features, 
-                                                 dataset->labels, images_loaded, 
+            int batch_images = read_cifar10_batch(filepath, dataset, images_loaded, 
                                                  10000); // Each batch has 10000 images
             if (batch_images == 0) {
                 printf("Warning: Failed to read batch %d\n", batch);
@@ -140,15 +118,12 @@ Dataset* load_cifar10_dataset(const char* data_dir, const char* is_test) {
         sprintf(filepath, "%s/%s", data_dir, CIFAR10_TEST_BATCH);
         printf("Loading test batch from %s\n", filepath);
         
-        int batch_images = read_cifar10_batch(filepath, dataset->features, 
-                                             dataset->labels, 0, 
+        int batch_images = read_cifar10_batch(filepath, dataset, 0, 
                                              num_samples);
         if (batch_images == 0) {
             printf("Error: Failed to read test batch\n");
             // Clean up
-            free(dataset->labels);
-            free(dataset->features);
-            free(dataset);
+            free_dataset(dataset);
             return NULL;
         }
         
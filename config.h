@@ -9,10 +9,29 @@
 // HD Computing parameters
 #define HD_LEVEL_COUNT 2
 #define RANDOMNESS 0
+#define HD_SEED 0  // Seed for the level and item tables (0 = new seed each run)
+#define HD_ITEM_MODE HD_ITEM_TABLE  // HD_ITEM_PROCEDURAL regenerates item vectors, HD_ITEM_PERMUTE rotates level vectors instead
+#define HD_BOUND_TABLE_MAX_BYTES (16 << 20)  // Precompute level XOR item rows up to this size (0 = never)
+#define HD_RETRAIN_EPOCHS 0  // Perceptron-style refinement epochs after training (0 = off)
+
+// Parallelism
+#define HD_NUM_THREADS 0  // Worker threads for training/inference (0 = all online CPUs)
+#define HD_BATCH_CHUNK 64 // Samples claimed at a time by batch inference
+#define HD_STREAM_BATCH 4096 // Samples per batch read by hd_train_stream
+
+// Encoded-sample cache
+#define HD_ENCODING_CACHE 0          // Reuse encoded samples across train/retrain/evaluate (1 = on)
+#define HD_ENCODING_SPILL_DIR ""     // Keep encodings in mmapped files here ("" = RAM)
+#define HD_ENCODED_CACHE_SLOTS 4     // Sample sets cached at a time
 
 // Dataset selection
 #define DATASET_TYPE DATASET_MNIST  // Default dataset
 
+// Dataset storage
+#define DATASET_ROW_ALIGNMENT 64  // Byte alignment of feature rows loaded into memory (0 = packed)
+#define DATASET_TEXT_CHUNK_BYTES (1 << 20) // Text datasets are parsed in parallel chunks of about this size
+#define DATASET_CACHE_DIR "./cache" // Quantized copies of text datasets ("" = no caching)
+
 // MNIST dataset parameters
 #define MNIST_IMAGE_ROWS 28
 #define MNIST_IMAGE_COLS 28
@@ -4,7 +4,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <ctype.h>
+#include "text_table.h"
+
+// Label of a row whose class field is missing
+#define CONNECT4_MISSING_LABEL 0xFF
 
 /*
  * The Connect-4 dataset contains sequences of game positions in the Connect-4 game.
@@ -29,10 +32,13 @@ static unsigned char symbol_to_value(char symbol) {
 }
 
 // Function to convert class labels to numeric values
-static unsigned char class_to_value(const char* class_str) {
-    if (strcmp(class_str, "win") == 0) return 0;
-    if (strcmp(class_str, "loss") == 0) return 1;
-    if (strcmp(class_str, "draw") == 0) return 2;
+static unsigned char class_to_value(const char* class_str, size_t length) {
+    // Ignore trailing whitespace such as a carriage return
+    while (length > 0 && (class_str[length - 1] == '\r' || class_str[length - 1] == ' ')) length--;
+    
+    if (length == 3 && strncmp(class_str, "win", 3) == 0) return 0;
+    if (length == 4 && strncmp(class_str, "loss", 4) == 0) return 1;
+    if (length == 4 && strncmp(class_str, "draw", 4) == 0) return 2;
     return 0; // Default to "win" for invalid classes
 }
 
@@ -43,49 +49,76 @@ static int is_test_sample(int sample_idx, float test_ratio) {
     return (sample_idx % 100) < (test_ratio * 100);
 }
 
+// Parse one line: 42 comma-separated board symbols followed by the class.
+// Comment lines are dropped; a missing class is marked for the caller.
+static int parse_connect4_row(void* arg, const char* p, const char* end,
+                              float* values, unsigned char* label) {
+    (void)arg;
+    
+    // Skip comments
+    if (p[0] == '#' || p[0] == '%') return TEXT_ROW_DROPPED;
+    
+    int field_idx = 0;
+    *label = CONNECT4_MISSING_LABEL;
+    while (p < end && *p != '\n') {
+        const char* field = p;
+        while (p < end && *p != ',' && *p != '\n') p++;
+        const char* field_end = p;
+        if (p < end && *p == ',') p++;
+        
+        // Empty fields are skipped, as with strtok
+        if (field == field_end) continue;
+        
+        if (field_idx < CONNECT4_FEATURE_COUNT) {
+            values[field_idx] = symbol_to_value(field[0]);
+        } else if (field_idx == CONNECT4_FEATURE_COUNT) {
+            // The last field is the class label
+            *label = class_to_value(field, (size_t)(field_end - field));
+        }
+        field_idx++;
+    }
+    
+    // Missing positions are blank
+    for (; field_idx < CONNECT4_FEATURE_COUNT; field_idx++) {
+        values[field_idx] = 0;
+    }
+    
+    return TEXT_ROW_KEPT;
+}
+
 // Load Connect-4 dataset
 Dataset* load_connect4_dataset(const char* data_path, const char* is_test) {
-    FILE *file;
     Dataset* dataset;
-    char line[1024];  // Buffer for reading lines
+    TextTable table;
     int is_training = (strcmp(is_test, "train") == 0);
     float test_ratio = 0.2; // 20% for testing, 80% for training
     
-    // First pass: count total samples and valid samples for the requested split
-    printf("Connect-4: First pass - counting samples\n");
+    // Parse all positions in parallel chunks, then pick the requested split
+    printf("Connect-4: Parsing samples\n");
     
-    file = fopen(data_path, "r");
-    if (!file) {
+    if (!load_text_table(data_path, CONNECT4_FEATURE_COUNT, parse_connect4_row, NULL, &table)) {
         printf("Failed to open Connect-4 data file: %s\n", data_path);
         return NULL;
     }
     
-    int total_samples = 0;
+    int total_samples = table.n_rows;
     int valid_samples = 0;
     
-    while (fgets(line, sizeof(line), file) != NULL) {
-        // Skip empty lines and comments
-        if (strlen(line) <= 1 || line[0] == '#' || line[0] == '%') continue;
-        
+    for (int i = 0; i < total_samples; i++) {
         // Check if this sample should be in the requested split
-        if (is_test_sample(total_samples, test_ratio) != is_training) {
-            total_samples++;
-            continue;
+        if (is_test_sample(i, test_ratio) == is_training) {
+            valid_samples++;
         }
-        
-        valid_samples++;
-        total_samples++;
     }
     
-    fclose(file);
-    
     printf("Connect-4: Found %d total samples, %d for %s set\n", 
            total_samples, valid_samples, is_training ? "training" : "test");
     
     // Allocate dataset structure
-    dataset = (Dataset*)malloc(sizeof(Dataset));
+    dataset = (Dataset*)calloc(1, sizeof(Dataset));
     if (!dataset) {
         printf("Failed to allocate memory for dataset\n");
+        free_text_table(&table);
         return NULL;
     }
     
@@ -96,93 +129,45 @@ Dataset* load_connect4_dataset(const char* data_path, const char* is_test) {
     dataset->feature_dimension = CONNECT4_FEATURE_COUNT;
     dataset->number_of_samples = valid_samples;
     
-    // Allocate memory for features and labels
-    dataset->features = (unsigned char**)malloc(valid_samples * sizeof(unsigned char*));
-    if (!dataset->features) {
-        printf("Failed to allocate memory for features\n");
-        free(dataset);
+    // Allocate the feature matrix in one block, plus the labels
+    if (!alloc_dataset_features(dataset, valid_samples, CONNECT4_FEATURE_COUNT)) {
+        free_text_table(&table);
+        free_dataset(dataset);
         return NULL;
     }
     
-    for (int i = 0; i < valid_samples; i++) {
-        dataset->features[i] = (unsigned char*)malloc(CONNECT4_FEATURE_COUNT * sizeof(unsigned char));
-        if (!dataset->features[i]) {
-            printf("Failed to allocate memory for sample %d\n", i);
-            for (int j = 0; j < i; j++) {
-                free(dataset->features[j]);
-            }
-            free(dataset->features);
-            free(dataset);
-            return NULL;
-        }
-    }
-    
     dataset->labels = (unsigned char*)malloc(valid_samples * sizeof(unsigned char));
     if (!dataset->labels) {
         printf("Failed to allocate memory for labels\n");
-        for (int i = 0; i < valid_samples; i++) {
-            free(dataset->features[i]);
-        }
-        free(dataset->features);
-        free(dataset);
-        return NULL;
-    }
-    
-    // Second pass: load data
-    printf("Connect-4: Second pass - loading data\n");
-    
-    file = fopen(data_path, "r");
-    if (!file) {
-        printf("Failed to open Connect-4 data file: %s\n", data_path);
-        for (int i = 0; i < valid_samples; i++) {
-            free(dataset->features[i]);
-        }
-        free(dataset->features);
-        free(dataset->labels);
-        free(dataset);
+        free_text_table(&table);
+        free_dataset(dataset);
         return NULL;
     }
     
-    int sample_idx = 0;
     int current_sample = 0;
     
-    while (fgets(line, sizeof(line), file) != NULL && current_sample < valid_samples) {
-        // Skip empty lines and comments
-        if (strlen(line) <= 1 || line[0] == '#' || line[0] == '%') continue;
-        
+    for (int sample_idx = 0; sample_idx < total_samples; sample_idx++) {
         // Check if this sample should be in the requested split
-        if (is_test_sample(sample_idx, test_ratio) != is_training) {
-            sample_idx++;
-            continue;
-        }
-        
-        // Remove newline if present
-        line[strcspn(line, "\n")] = 0;
-        
-        // Tokenize line by commas
-        char *token = strtok(line, ",");
-        int feature_idx = 0;
+        if (is_test_sample(sample_idx, test_ratio) != is_training) continue;
         
-        // Process features (42 positions)
-        while (token && feature_idx < CONNECT4_FEATURE_COUNT) {
-            dataset->features[current_sample][feature_idx] = symbol_to_value(token[0]);
-            feature_idx++;
-            token = strtok(NULL, ",");
+        // Board symbols were parsed as their 8-bit values
+        const float* values = table.values + (size_t)sample_idx * CONNECT4_FEATURE_COUNT;
+        unsigned char* sample = dataset_sample(dataset, current_sample);
+        for (int f = 0; f < CONNECT4_FEATURE_COUNT; f++) {
+            sample[f] = (unsigned char)values[f];
         }
         
-        // The last token is the class label
-        if (token) {
-            dataset->labels[current_sample] = class_to_value(token);
+        if (table.labels[sample_idx] != CONNECT4_MISSING_LABEL) {
+            dataset->labels[current_sample] = table.labels[sample_idx];
         } else {
             printf("Warning: Missing class label for sample %d\n", sample_idx);
             dataset->labels[current_sample] = 0; // Default to "win"
         }
         
         current_sample++;
-        sample_idx++;
     }
     
-    fclose(file);
+    free_text_table(&table);
     
     // Verify that we loaded the expected number of samples
     if (current_sample != valid_samples) {
@@ -5,10 +5,60 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
-// Main dataset loading function - delegates to specific loaders
+// Text datasets are worth caching in quantized form. Fills in their source
+// files and a cache key, and returns the number of sources (0 = not cached).
+static int dataset_cache_sources(DatasetType type, const char* train_or_test,
+                                 const char** sources, const char** key) {
+    int is_train = strcmp(train_or_test, "train") == 0;
+    
+    switch (type) {
+        case DATASET_UCIHAR:
+            *key = "ucihar";
+            sources[0] = is_train ? UCIHAR_TRAIN_FEATURES : UCIHAR_TEST_FEATURES;
+            sources[1] = is_train ? UCIHAR_TRAIN_LABELS : UCIHAR_TEST_LABELS;
+            return 2;
+        case DATASET_ISOLET:
+            *key = "isolet";
+            sources[0] = is_train ? ISOLET_TRAIN_FEATURES : ISOLET_TEST_FEATURES;
+            return 1;
+        case DATASET_CONNECT4:
+            *key = "connect4";
+            sources[0] = CONNECT4_DATA_FILE;
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// Main dataset loading function - delegates to specific loaders.
+// Text datasets are served from DATASET_CACHE_DIR when an up-to-date
+// cache exists, and cached after they have been parsed.
 Dataset* load_dataset(DatasetType type, const char* train_or_test) {
     Dataset* dataset = NULL;
+    const char* sources[2];
+    const char* key = NULL;
+    char cache_path[512];
+    uint64_t source_hash = 0;
+    
+    int n_sources = DATASET_CACHE_DIR[0] ? 
+                    dataset_cache_sources(type, train_or_test, sources, &key) : 0;
+    if (n_sources > 0) {
+        snprintf(cache_path, sizeof(cache_path), "%s/%s_%s.cache", 
+                 DATASET_CACHE_DIR, key, train_or_test);
+        source_hash = dataset_source_hash(sources, n_sources, train_or_test);
+        dataset = source_hash ? load_dataset_cache(cache_path, source_hash) : NULL;
+        if (dataset) {
+            printf("Loaded %s %s dataset from cache: %d samples, %d features, %d classes\n",
+                   dataset->name, train_or_test, dataset->number_of_samples, 
+                   dataset->feature_dimension, dataset->num_classes);
+            return dataset;
+        }
+    }
     
     switch (type) {
         case DATASET_MNIST:
@@ -61,27 +111,221 @@ Dataset* load_dataset(DatasetType type, const char* train_or_test) {
             return NULL;
     }
     
+    if (dataset && source_hash) {
+        save_dataset_cache(dataset, cache_path, source_hash);
+    }
+    
     return dataset;
 }
 
 // Free dataset resources
 void free_dataset(Dataset* dataset) {
     if (dataset) {
-        if (dataset->features) {
-            for (int i = 0; i < dataset->number_of_samples; i++) {
-                free(dataset->features[i]);
-            }
-            free(dataset->features);
+        if (dataset->mapped_features) {
+            munmap(dataset->mapped_features, dataset->mapped_features_size);
+        } else {
+            free(dataset->feature_data);
         }
         
-        if (dataset->labels) {
+        // Labels and ranges of a cached dataset live inside mapped_features
+        if (dataset->mapped_labels) {
+            munmap(dataset->mapped_labels, dataset->mapped_labels_size);
+        } else if (!dataset->mapped_features) {
             free(dataset->labels);
         }
         
+        if (!dataset->mapped_features) {
+            free(dataset->feature_min);
+        }
+        
         free(dataset);
     }
 }
 
+// Allocate a feature matrix as a single block. With DATASET_ROW_ALIGNMENT
+// set, every row starts on an aligned boundary.
+static unsigned char* alloc_feature_rows(int number_of_samples, int feature_dimension, 
+                                         size_t* stride) {
+    size_t alignment = DATASET_ROW_ALIGNMENT;
+    
+    *stride = (size_t)feature_dimension;
+    if (alignment > 0) {
+        *stride = (*stride + alignment - 1) / alignment * alignment;
+    }
+    
+    size_t size = (size_t)number_of_samples * *stride;
+    if (size == 0) size = 1;
+    
+    unsigned char* data = alignment > 0 ? (unsigned char*)aligned_alloc(alignment, size)
+                                        : (unsigned char*)malloc(size);
+    if (!data) {
+        printf("Failed to allocate memory for features\n");
+    }
+    return data;
+}
+
+int alloc_dataset_features(Dataset* dataset, int number_of_samples, int feature_dimension) {
+    size_t stride;
+    unsigned char* data = alloc_feature_rows(number_of_samples, feature_dimension, &stride);
+    if (!data) {
+        return 0;
+    }
+    
+    dataset->feature_data = data;
+    dataset->feature_stride = (int)stride;
+    return 1;
+}
+
+// Allocate the per-feature quantization range as one block
+int alloc_feature_ranges(Dataset* dataset, int feature_dimension) {
+    float* ranges = (float*)malloc(2 * (size_t)feature_dimension * sizeof(float));
+    if (!ranges) {
+        printf("Failed to allocate memory for feature ranges\n");
+        return 0;
+    }
+    
+    dataset->feature_min = ranges;
+    dataset->feature_max = ranges + feature_dimension;
+    return 1;
+}
+
+// Allocate the buffers of a batch holding up to capacity samples
+int alloc_dataset_batch(DatasetBatch* batch, int capacity, int feature_dimension) {
+    size_t stride;
+    memset(batch, 0, sizeof(DatasetBatch));
+    
+    batch->feature_data = alloc_feature_rows(capacity, feature_dimension, &stride);
+    batch->labels = (unsigned char*)malloc(capacity > 0 ? capacity : 1);
+    if (!batch->feature_data || !batch->labels) {
+        printf("Failed to allocate memory for a batch of %d samples\n", capacity);
+        free_dataset_batch(batch);
+        return 0;
+    }
+    
+    batch->capacity = capacity;
+    batch->feature_dimension = feature_dimension;
+    batch->feature_stride = (int)stride;
+    return 1;
+}
+
+void free_dataset_batch(DatasetBatch* batch) {
+    if (batch) {
+        free(batch->feature_data);
+        free(batch->labels);
+        batch->feature_data = NULL;
+        batch->labels = NULL;
+        batch->capacity = 0;
+        batch->number_of_samples = 0;
+    }
+}
+
+// Create a stream around a next-batch callback. close (if any) is called
+// with state when the stream is freed.
+DatasetStream* init_dataset_stream(const char* name, int feature_dimension, int num_classes,
+                                   DatasetNextBatchFn next_batch, void (*close)(void* state),
+                                   void* state) {
+    DatasetStream* stream = (DatasetStream*)calloc(1, sizeof(DatasetStream));
+    if (!stream) {
+        printf("Failed to allocate memory for dataset stream\n");
+        return NULL;
+    }
+    
+    snprintf(stream->name, sizeof(stream->name), "%s", name);
+    stream->feature_dimension = feature_dimension;
+    stream->num_classes = num_classes;
+    stream->next_batch = next_batch;
+    stream->close = close;
+    stream->state = state;
+    return stream;
+}
+
+void free_dataset_stream(DatasetStream* stream) {
+    if (stream) {
+        if (stream->close) {
+            stream->close(stream->state);
+        }
+        free(stream);
+    }
+}
+
+// Read the next batch; batch->number_of_samples is set to the samples read
+int read_dataset_batch(DatasetStream* stream, DatasetBatch* batch) {
+    if (batch->feature_dimension != stream->feature_dimension) {
+        printf("Batch holds %d features, stream has %d\n", 
+               batch->feature_dimension, stream->feature_dimension);
+        return -1;
+    }
+    
+    int n = stream->next_batch(stream->state, batch);
+    batch->number_of_samples = n > 0 ? n : 0;
+    return n;
+}
+
+// Stream over a dataset that is already in memory
+typedef struct {
+    const Dataset* dataset;
+    int next;
+} MemoryStreamState;
+
+static int next_memory_batch(void* state, DatasetBatch* batch) {
+    MemoryStreamState* memory = (MemoryStreamState*)state;
+    const Dataset* dataset = memory->dataset;
+    int n = dataset->number_of_samples - memory->next;
+    if (n > batch->capacity) n = batch->capacity;
+    
+    for (int i = 0; i < n; i++) {
+        memcpy(batch_sample(batch, i), dataset_sample(dataset, memory->next + i), 
+               dataset->feature_dimension);
+        batch->labels[i] = dataset->labels[memory->next + i];
+    }
+    memory->next += n;
+    return n;
+}
+
+DatasetStream* open_dataset_stream(const Dataset* dataset) {
+    MemoryStreamState* state = (MemoryStreamState*)calloc(1, sizeof(MemoryStreamState));
+    if (!state) {
+        printf("Failed to allocate memory for dataset stream\n");
+        return NULL;
+    }
+    state->dataset = dataset;
+    
+    DatasetStream* stream = init_dataset_stream(dataset->name, dataset->feature_dimension,
+                                                dataset->num_classes, next_memory_batch, 
+                                                free, state);
+    if (!stream) {
+        free(state);
+    }
+    return stream;
+}
+
+// Map a whole file read-only. The pages come straight from the page cache,
+// so concurrent processes reading the same file share them.
+void* map_file_readonly(const char* path, size_t* size) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+    
+    void* base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return NULL;
+    }
+    
+    // Samples are consumed front to back
+    madvise(base, (size_t)st.st_size, MADV_SEQUENTIAL);
+    
+    *size = (size_t)st.st_size;
+    return base;
+}
+
 // Normalize floating point features to range [0, 1]
 void normalize_features(float* features, int size, float min, float max) {
     float range = max - min;
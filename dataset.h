@@ -3,15 +3,29 @@
 #define DATASET_H
 
 #include <stdint.h>
+#include <stddef.h>
 
 // Generic Dataset Structure
 typedef struct {
     int number_of_samples;       // Total number of samples
     int feature_dimension;       // Number of features per sample
     int num_classes;             // Number of classes
-    unsigned char **features;    // 2D array of features (quantized to 8-bit)
+    unsigned char *feature_data; // Row-major feature matrix (quantized to 8-bit)
+    int feature_stride;          // Bytes from one sample to the next in feature_data
     unsigned char *labels;       // 1D array of labels
     
+    // Per-feature range the float features were quantized from
+    // (feature_max follows feature_min in one block; NULL for 8-bit sources)
+    float *feature_min;
+    float *feature_max;
+    
+    // Memory-mapped files backing feature_data / labels (NULL if none).
+    // A dataset cache maps everything, labels and ranges included, in mapped_features.
+    void *mapped_features;
+    size_t mapped_features_size;
+    void *mapped_labels;
+    size_t mapped_labels_size;
+    
     // Dataset information
     char name[64];               // Dataset name
     int original_feature_type;   // 0 = 8-bit, 1 = float, 2 = other
@@ -29,10 +43,64 @@ typedef enum {
     DATASET_COUNT
 } DatasetType;
 
+// Features of sample 'index'
+static inline unsigned char* dataset_sample(const Dataset* dataset, int index) {
+    return dataset->feature_data + (size_t)index * dataset->feature_stride;
+}
+
+// A batch of samples read from a DatasetStream. The buffers belong to the
+// consumer, which may keep several batches in flight.
+typedef struct {
+    int capacity;                // Maximum samples per batch
+    int number_of_samples;       // Samples currently in the batch
+    int feature_dimension;
+    int feature_stride;          // Bytes from one sample to the next
+    unsigned char *feature_data; // capacity rows, padded like Dataset rows
+    unsigned char *labels;
+} DatasetBatch;
+
+// Fill batch with up to batch->capacity samples. Returns the number of
+// samples read, 0 at the end of the stream and -1 on error.
+typedef int (*DatasetNextBatchFn)(void* state, DatasetBatch* batch);
+
+// A dataset read sequentially in batches, for data that does not fit in memory
+typedef struct {
+    char name[64];
+    int feature_dimension;
+    int num_classes;
+    DatasetNextBatchFn next_batch;
+    void (*close)(void* state);  // Releases state (may be NULL)
+    void* state;
+} DatasetStream;
+
+// Features of sample 'index' of a batch
+static inline unsigned char* batch_sample(const DatasetBatch* batch, int index) {
+    return batch->feature_data + (size_t)index * batch->feature_stride;
+}
+
 // Function declarations
 Dataset* load_dataset(DatasetType type, const char* train_or_test);
 void free_dataset(Dataset* dataset);
 
+// Allocate the feature matrix of a dataset in one block
+// (rows padded to DATASET_ROW_ALIGNMENT)
+int alloc_dataset_features(Dataset* dataset, int number_of_samples, int feature_dimension);
+
+// Allocate feature_min / feature_max for a dataset
+int alloc_feature_ranges(Dataset* dataset, int feature_dimension);
+
+// Streams: wrap a next-batch callback, or read an in-memory dataset / IDX files
+DatasetStream* init_dataset_stream(const char* name, int feature_dimension, int num_classes,
+                                   DatasetNextBatchFn next_batch, void (*close)(void* state),
+                                   void* state);
+void free_dataset_stream(DatasetStream* stream);
+DatasetStream* open_dataset_stream(const Dataset* dataset);
+DatasetStream* open_idx_stream(const char* image_path, const char* label_path,
+                               const char* name, int num_classes);
+int read_dataset_batch(DatasetStream* stream, DatasetBatch* batch);
+int alloc_dataset_batch(DatasetBatch* batch, int capacity, int feature_dimension);
+void free_dataset_batch(DatasetBatch* batch);
+
 // Dataset-specific loaders (to be implemented in separate files)
 Dataset* load_mnist_dataset(const char* image_path, const char* label_path);
 Dataset* load_ucihar_dataset(const char* feature_path, const char* label_path);
@@ -41,6 +109,18 @@ Dataset* load_cifar10_dataset(const char* data_dir, const char* is_test);
 Dataset* load_fmnist_dataset(const char* image_path, const char* label_path);
 Dataset* load_connect4_dataset(const char* data_path, const char* is_test);
 
+// Map an IDX image/label file pair (MNIST layout) without copying the pixels
+Dataset* load_idx_dataset(const char* image_path, const char* label_path, 
+                          const char* name, int num_classes);
+
+// Map a whole file read-only; returns NULL on failure
+void* map_file_readonly(const char* path, size_t* size);
+
+// Quantized dataset cache (see dataset_cache.c)
+uint64_t dataset_source_hash(const char** paths, int n_paths, const char* split);
+Dataset* load_dataset_cache(const char* path, uint64_t source_hash);
+int save_dataset_cache(const Dataset* dataset, const char* path, uint64_t source_hash);
+
 // Preprocessing functions
 void normalize_features(float* features, int size, float min, float max);
 void quantize_features(float* features, unsigned char* quantized, int size);
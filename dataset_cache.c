@@ -0,0 +1,229 @@
+// dataset_cache.c - Quantized dataset cache for text datasets
+#include "dataset.h"
+#include "config.h"
+#include "hd_hash.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*
+ * Parsing the text datasets (UCIHAR, ISOLET, Connect-4) dominates start-up,
+ * so the quantized result is written once to DATASET_CACHE_DIR and mapped on
+ * later runs. The file is laid out exactly as the Dataset uses it:
+ *
+ *   [header][labels][feature min][feature max][feature rows]
+ *
+ * Sections start on DATASET_CACHE_ALIGNMENT boundaries and feature rows keep
+ * the stride they were loaded with. A cache is only used when its source
+ * hash (path, size and modification time of every source file) still matches.
+ */
+
+#define DATASET_CACHE_MAGIC "HDDATA\0\0"
+#define DATASET_CACHE_MAGIC_SIZE 8
+#define DATASET_CACHE_VERSION 1
+#define DATASET_CACHE_BYTE_ORDER 0x01020304u
+#define DATASET_CACHE_ALIGNMENT 64
+
+typedef struct {
+    char magic[DATASET_CACHE_MAGIC_SIZE];
+    uint32_t version;
+    uint32_t byte_order;
+    uint64_t source_hash;
+
+    int32_t number_of_samples;
+    int32_t feature_dimension;
+    int32_t num_classes;
+    int32_t feature_stride;
+    int32_t original_feature_type;
+    int32_t has_feature_range;     // 1 if the min/max sections are present
+    char name[64];
+
+    uint64_t label_offset;
+    uint64_t range_offset;         // min section; max follows immediately
+    uint64_t feature_offset;
+    uint64_t file_size;
+    unsigned char reserved[48];
+} DatasetCacheHeader;
+
+_Static_assert(sizeof(DatasetCacheHeader) == 192, "cache header must stay 192 bytes");
+_Static_assert(sizeof(DatasetCacheHeader) % DATASET_CACHE_ALIGNMENT == 0, "sections must stay aligned");
+
+static uint64_t align_offset(uint64_t offset) {
+    return (offset + DATASET_CACHE_ALIGNMENT - 1) / DATASET_CACHE_ALIGNMENT * DATASET_CACHE_ALIGNMENT;
+}
+
+// Fill in the identification fields and section offsets for a dataset shape
+static void dataset_cache_layout(DatasetCacheHeader* header, int number_of_samples,
+                                 int feature_dimension, int feature_stride,
+                                 int has_feature_range, uint64_t source_hash) {
+    memset(header, 0, sizeof(DatasetCacheHeader));
+    memcpy(header->magic, DATASET_CACHE_MAGIC, DATASET_CACHE_MAGIC_SIZE);
+    header->version = DATASET_CACHE_VERSION;
+    header->byte_order = DATASET_CACHE_BYTE_ORDER;
+    header->source_hash = source_hash;
+    header->number_of_samples = number_of_samples;
+    header->feature_dimension = feature_dimension;
+    header->feature_stride = feature_stride;
+    header->has_feature_range = has_feature_range;
+
+    uint64_t offset = sizeof(DatasetCacheHeader);
+    header->label_offset = offset;
+    offset = align_offset(offset + (uint64_t)number_of_samples);
+    header->range_offset = offset;
+    if (has_feature_range) {
+        offset = align_offset(offset + 2 * (uint64_t)feature_dimension * sizeof(float));
+    }
+    header->feature_offset = offset;
+    offset += (uint64_t)number_of_samples * feature_stride;
+    header->file_size = offset;
+}
+
+// Hash of the split name and the path, size and modification time of every
+// source file. Returns 0 if any source is missing.
+uint64_t dataset_source_hash(const char** paths, int n_paths, const char* split) {
+    uint64_t hash = hd_hash_bytes(HD_HASH_SEED, split, strlen(split) + 1);
+
+    for (int i = 0; i < n_paths; i++) {
+        struct stat st;
+        if (stat(paths[i], &st) != 0) {
+            return 0;
+        }
+
+        uint64_t size = (uint64_t)st.st_size;
+        int64_t mtime_sec = (int64_t)st.st_mtim.tv_sec;
+        int64_t mtime_nsec = (int64_t)st.st_mtim.tv_nsec;
+        hash = hd_hash_bytes(hash, paths[i], strlen(paths[i]) + 1);
+        hash = hd_hash_bytes(hash, &size, sizeof(size));
+        hash = hd_hash_bytes(hash, &mtime_sec, sizeof(mtime_sec));
+        hash = hd_hash_bytes(hash, &mtime_nsec, sizeof(mtime_nsec));
+    }
+    return hash ? hash : 1;
+}
+
+// Map a cache file and use it in place as a dataset. Returns NULL (silently)
+// if there is no usable cache for this source hash.
+Dataset* load_dataset_cache(const char* path, uint64_t source_hash) {
+    size_t file_size;
+    unsigned char* base = (unsigned char*)map_file_readonly(path, &file_size);
+    if (!base) {
+        return NULL;
+    }
+
+    const DatasetCacheHeader* header = (const DatasetCacheHeader*)base;
+    if (file_size < sizeof(DatasetCacheHeader) ||
+        memcmp(header->magic, DATASET_CACHE_MAGIC, DATASET_CACHE_MAGIC_SIZE) != 0 ||
+        header->version != DATASET_CACHE_VERSION ||
+        header->byte_order != DATASET_CACHE_BYTE_ORDER ||
+        header->source_hash != source_hash) {
+        munmap(base, file_size);
+        return NULL;
+    }
+
+    // Recompute the layout from the header fields so that a damaged offset
+    // can never point outside the mapping
+    DatasetCacheHeader expected;
+    int valid_shape = header->number_of_samples >= 0 && header->feature_dimension > 0 &&
+                      header->feature_stride >= header->feature_dimension;
+    if (valid_shape) {
+        dataset_cache_layout(&expected, header->number_of_samples, header->feature_dimension,
+                             header->feature_stride, header->has_feature_range != 0, source_hash);
+    }
+    if (!valid_shape ||
+        expected.label_offset != header->label_offset ||
+        expected.range_offset != header->range_offset ||
+        expected.feature_offset != header->feature_offset ||
+        expected.file_size != header->file_size || header->file_size != file_size) {
+        printf("Ignoring damaged dataset cache: %s\n", path);
+        munmap(base, file_size);
+        return NULL;
+    }
+
+    Dataset* dataset = (Dataset*)calloc(1, sizeof(Dataset));
+    if (!dataset) {
+        printf("Failed to allocate memory for dataset\n");
+        munmap(base, file_size);
+        return NULL;
+    }
+
+    memcpy(dataset->name, header->name, sizeof(dataset->name) - 1);
+    dataset->original_feature_type = header->original_feature_type;
+    dataset->number_of_samples = header->number_of_samples;
+    dataset->feature_dimension = header->feature_dimension;
+    dataset->num_classes = header->num_classes;
+
+    // Every section lives in the one mapping owned by the dataset
+    dataset->mapped_features = base;
+    dataset->mapped_features_size = file_size;
+    dataset->labels = base + header->label_offset;
+    dataset->feature_data = base + header->feature_offset;
+    dataset->feature_stride = header->feature_stride;
+    if (header->has_feature_range) {
+        dataset->feature_min = (float*)(base + header->range_offset);
+        dataset->feature_max = dataset->feature_min + header->feature_dimension;
+    }
+
+    return dataset;
+}
+
+// Write a loaded dataset to a cache file. The file is written under a
+// temporary name and renamed, so a reader never sees a partial cache.
+int save_dataset_cache(const Dataset* dataset, const char* path, uint64_t source_hash) {
+    if (!dataset || !path || source_hash == 0) {
+        return 0;
+    }
+
+    if (mkdir(DATASET_CACHE_DIR, 0755) != 0 && errno != EEXIST) {
+        printf("Error creating cache directory: %s\n", DATASET_CACHE_DIR);
+        return 0;
+    }
+
+    DatasetCacheHeader header;
+    dataset_cache_layout(&header, dataset->number_of_samples, dataset->feature_dimension,
+                         dataset->feature_stride, dataset->feature_min != NULL, source_hash);
+    header.num_classes = dataset->num_classes;
+    header.original_feature_type = dataset->original_feature_type;
+    memcpy(header.name, dataset->name, sizeof(header.name) - 1);
+
+    // Assemble the file exactly as it will be mapped (padding stays zero)
+    unsigned char* image = (unsigned char*)calloc(1, header.file_size);
+    if (!image) {
+        printf("Failed to allocate dataset cache buffer\n");
+        return 0;
+    }
+
+    memcpy(image, &header, sizeof(header));
+    memcpy(image + header.label_offset, dataset->labels, (size_t)dataset->number_of_samples);
+    if (header.has_feature_range) {
+        size_t range_bytes = (size_t)dataset->feature_dimension * sizeof(float);
+        memcpy(image + header.range_offset, dataset->feature_min, range_bytes);
+        memcpy(image + header.range_offset + range_bytes, dataset->feature_max, range_bytes);
+    }
+    memcpy(image + header.feature_offset, dataset->feature_data,
+           (size_t)dataset->number_of_samples * dataset->feature_stride);
+
+    char temp_path[512];
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", path);
+
+    FILE* fp = fopen(temp_path, "wb");
+    if (!fp) {
+        printf("Error opening file for writing: %s\n", temp_path);
+        free(image);
+        return 0;
+    }
+
+    int ok = fwrite(image, 1, header.file_size, fp) == header.file_size;
+    ok = (fclose(fp) == 0) && ok;
+    free(image);
+
+    if (!ok || rename(temp_path, path) != 0) {
+        printf("Error writing dataset cache: %s\n", path);
+        remove(temp_path);
+        return 0;
+    }
+
+    printf("Saved dataset cache: %s (%llu bytes)\n", path, (unsigned long long)header.file_size);
+    return 1;
+}
@@ -0,0 +1,47 @@
+// hd_arena.c - Implementation of the aligned bump allocator
+#include "hd_arena.h"
+#include "hd_vector.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+size_t arena_footprint(size_t bytes) {
+    return (bytes + HD_ALIGNMENT - 1) / HD_ALIGNMENT * HD_ALIGNMENT;
+}
+
+HDArena* init_arena(size_t size) {
+    HDArena* arena = (HDArena*)malloc(sizeof(HDArena));
+    if (!arena) return NULL;
+
+    arena->size = arena_footprint(size);
+    arena->used = 0;
+    arena->base = (unsigned char*)aligned_alloc(HD_ALIGNMENT, arena->size ? arena->size 
+                                                                          : HD_ALIGNMENT);
+    if (!arena->base) {
+        free(arena);
+        return NULL;
+    }
+    memset(arena->base, 0, arena->size);
+
+    return arena;
+}
+
+// Hand out the next aligned, zeroed block (NULL when the arena is full)
+void* arena_alloc(HDArena* arena, size_t bytes) {
+    size_t needed = arena_footprint(bytes);
+    if (!arena || needed > arena->size - arena->used) {
+        printf("Arena exhausted (%zu bytes requested)\n", bytes);
+        return NULL;
+    }
+
+    void* block = arena->base + arena->used;
+    arena->used += needed;
+    return block;
+}
+
+void free_arena(HDArena* arena) {
+    if (arena) {
+        free(arena->base);
+        free(arena);
+    }
+}
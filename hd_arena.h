@@ -0,0 +1,23 @@
+// hd_arena.h - Aligned bump allocator for model tensors
+#ifndef HD_ARENA_H
+#define HD_ARENA_H
+
+#include <stddef.h>
+
+// One contiguous, 64-byte aligned block carved into tables. Allocations are
+// never freed individually; the whole arena is released at once.
+typedef struct {
+    unsigned char* base;    // Start of the block
+    size_t size;            // Capacity in bytes
+    size_t used;            // Bytes handed out so far
+} HDArena;
+
+// Bytes an allocation of 'bytes' takes up inside an arena
+size_t arena_footprint(size_t bytes);
+
+// Function declarations
+HDArena* init_arena(size_t size);
+void* arena_alloc(HDArena* arena, size_t bytes);
+void free_arena(HDArena* arena);
+
+#endif // HD_ARENA_H
@@ -12,7 +12,7 @@ BoundVectors* init_bound_vectors(int dimension, int feature_dimension) {
     bv->feature_dimension = feature_dimension;
 
     // Allocate memory for all binding results
-    bv->bound_vectors = (char**)malloc(feature_dimension * sizeof(char*));
+    bv->bound_vectors = (uint64_t**)malloc(feature_dimension * sizeof(uint64_t*));
     if (!bv->bound_vectors) {
         free(bv);
         return NULL;
@@ -20,7 +20,7 @@ BoundVectors* init_bound_vectors(int dimension, int feature_dimension) {
 
     // Allocate memory for each binding result
     for (int i = 0; i < feature_dimension; i++) {
-        bv->bound_vectors[i] = (char*)malloc(dimension * sizeof(char));
+        bv->bound_vectors[i] = alloc_hypervector(dimension);
         if (!bv->bound_vectors[i]) {
             // Clean up already allocated memory
             for (int j = 0; j < i; j++) {
@@ -47,24 +47,76 @@ void free_bound_vectors(BoundVectors* bv) {
     }
 }
 
-// Binary binding operation (XOR)
-void bind_vectors(char* level_vector, char* item_vector, char* result, int dimension) {
-    for (int i = 0; i < dimension; i++) {
-        // XOR operation for binary encoding (0,1)
-        result[i] = level_vector[i] ^ item_vector[i];
-    }
+// Binary binding operation (XOR), 64 elements per word
+void bind_vectors(const uint64_t* level_vector, const uint64_t* item_vector, 
+                  uint64_t* result, int dimension) {
+    xor_hypervectors(level_vector, item_vector, result, dimension);
 }
 
 // Bind feature vector using item memory and XOR binding
 void bind_features(unsigned char* features, HDLevelVectors* hd, HDMapping* mapping, 
-                  char** item_memory, BoundVectors* bound) {
+                  const uint64_t* item_memory, BoundVectors* bound) {
+    int stride = HD_ROW_WORDS(bound->dimension);
+
     for (int i = 0; i < bound->feature_dimension; i++) {
         // Get level vector for the feature value
-        char* level_vector = get_level_vector(hd, features[i], mapping);
+        uint64_t* level_vector = get_level_vector(hd, features[i], mapping);
         
         // Perform binding operation (XOR)
-        for (int j = 0; j < bound->dimension; j++) {
-            bound->bound_vectors[i][j] = level_vector[j] ^ item_memory[i][j];
+        bind_vectors(level_vector, hd_row(item_memory, stride, i), 
+                     bound->bound_vectors[i], bound->dimension);
+    }
+}
+
+// Bytes of a bound table: levels rows per feature, HD_ROW_WORDS(dimension) apart
+size_t bound_table_bytes(int levels, int feature_dimension, int dimension) {
+    return arena_footprint((size_t)levels * feature_dimension * HD_ROW_WORDS(dimension) * 
+                           sizeof(uint64_t));
+}
+
+// Bind every level vector to every item vector once, so encoding a sample
+// only has to look up one precomputed row per feature
+void fill_bound_table(uint64_t* table, const HDLevelVectors* hd, const uint64_t* item_memory,
+                      int feature_dimension) {
+    int stride = HD_ROW_WORDS(hd->dimension);
+
+    for (int i = 0; i < feature_dimension; i++) {
+        for (int l = 0; l < hd->levels; l++) {
+            bind_vectors(level_vector(hd, l), hd_row(item_memory, stride, i),
+                         (uint64_t*)bound_row(table, stride, hd->levels, i, l), hd->dimension);
         }
     }
-}
\ No newline at end of file
+}
+
+// Lay out the dimension bits of 'vector' twice in a row, so any rotation by
+// 0 <= shift < dimension is one contiguous run of bits. 'doubled' holds
+// HD_DOUBLED_WORDS(dimension) words.
+void double_hypervector(const uint64_t* vector, uint64_t* doubled, int dimension) {
+    int words = HD_WORDS(dimension);
+    int bits = dimension % HD_WORD_BITS;
+
+    for (int w = 0; w < HD_DOUBLED_WORDS(dimension); w++) {
+        doubled[w] = 0;
+    }
+    for (int w = 0; w < words; w++) {
+        doubled[w] = vector[w];
+    }
+
+    // Second copy starts at bit 'dimension', in the middle of a word unless
+    // the dimension is a multiple of 64
+    for (int w = 0; w < words; w++) {
+        doubled[words - 1 + (bits ? 0 : 1) + w] |= bits ? vector[w] << bits : vector[w];
+        if (bits) {
+            doubled[words + w] |= vector[w] >> (HD_WORD_BITS - bits);
+        }
+    }
+}
+
+// Rotate a vector by 'shift' bits: result bit j = vector bit (j + shift) mod dimension
+void rotate_hypervector(const uint64_t* doubled, int shift, uint64_t* result, int dimension) {
+    int words = HD_WORDS(dimension);
+    for (int w = 0; w < words; w++) {
+        result[w] = rotated_word(doubled, shift, w);
+    }
+    result[words - 1] &= hd_tail_mask(dimension);
+}
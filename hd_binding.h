@@ -9,14 +9,39 @@
 typedef struct {
     int dimension;          // Vector dimension
     int feature_dimension;  // Number of features
-    char **bound_vectors;   // Array of bound vectors
+    uint64_t **bound_vectors; // Array of bound vectors (packed)
 } BoundVectors;
 
+// Word 'word' of a vector rotated by 'shift' bits (rho permutation), read
+// from its doubled copy (see double_hypervector): a funnel shift of two
+// neighbouring words, so whole rotated vectors stream without branches.
+static inline uint64_t rotated_word(const uint64_t* doubled, int shift, int word) {
+    const uint64_t* src = doubled + shift / HD_WORD_BITS + word;
+    int bits = shift % HD_WORD_BITS;
+    return bits ? (src[0] >> bits) | (src[1] << (HD_WORD_BITS - bits)) : src[0];
+}
+
+// Precomputed level XOR item row of one (feature, level) pair in a bound
+// table (see fill_bound_table)
+static inline const uint64_t* bound_row(const uint64_t* table, int stride, int levels,
+                                        int feature, int level) {
+    return hd_row(table, stride, feature * levels + level);
+}
+
+// Words needed for the doubled copy of a vector
+#define HD_DOUBLED_WORDS(dimension) (2 * HD_WORDS(dimension) + 1)
+
 // Function declarations
+size_t bound_table_bytes(int levels, int feature_dimension, int dimension);
+void fill_bound_table(uint64_t* table, const HDLevelVectors* hd, const uint64_t* item_memory,
+                      int feature_dimension);
+void double_hypervector(const uint64_t* vector, uint64_t* doubled, int dimension);
+void rotate_hypervector(const uint64_t* doubled, int shift, uint64_t* result, int dimension);
 BoundVectors* init_bound_vectors(int dimension, int feature_dimension);
 void free_bound_vectors(BoundVectors* bv);
-void bind_vectors(char* level_vector, char* item_vector, char* result, int dimension);
+void bind_vectors(const uint64_t* level_vector, const uint64_t* item_vector, 
+                  uint64_t* result, int dimension);
 void bind_features(unsigned char* features, HDLevelVectors* hd, HDMapping* mapping, 
-                  char** item_memory, BoundVectors* bound);
+                  const uint64_t* item_memory, BoundVectors* bound);
 
 #endif // HD_BINDING_H
\ No newline at end of file
@@ -1,26 +1,29 @@
 // hd_bundling.c - Implementation of bundling operations
 #include "hd_bundling.h"
+#include "hd_random.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 BundledVector* init_bundled_vector(int dimension) {
-    BundledVector* bv = (BundledVector*)malloc(sizeof(BundledVector));
+    BundledVector* bv = (BundledVector*)calloc(1, sizeof(BundledVector));
     if (!bv) return NULL;
 
     bv->dimension = dimension;
+    int words = HD_WORDS(dimension);
     
-    // Allocate memory for sum vector
-    bv->sum_vector = (int*)calloc(dimension, sizeof(int));  // Initialize to 0 with calloc
-    if (!bv->sum_vector) {
-        free(bv);
-        return NULL;
-    }
+    // Allocate memory for sum vector, one counter per bit of every word
+    bv->sum_vector = (int*)calloc(words * HD_WORD_BITS, sizeof(int));  // Initialize to 0 with calloc
 
     // Allocate memory for final binarized vector
-    bv->final_vector = (char*)malloc(dimension * sizeof(char));
-    if (!bv->final_vector) {
-        free(bv->sum_vector);
-        free(bv);
+    bv->final_vector = alloc_hypervector(dimension);
+
+    // Bit-sliced counters and the block of rows being counted
+    bv->planes = (uint64_t*)calloc((size_t)HD_MAX_COUNTER_PLANES * words, sizeof(uint64_t));
+    bv->rows = (uint64_t*)calloc((size_t)HD_BUNDLE_BLOCK * words, sizeof(uint64_t));
+
+    if (!bv->sum_vector || !bv->final_vector || !bv->planes || !bv->rows) {
+        free_bundled_vector(bv);
         return NULL;
     }
 
@@ -31,31 +34,244 @@ void free_bundled_vector(BundledVector* bv) {
     if (bv) {
         free(bv->sum_vector);
         free(bv->final_vector);
+        free(bv->planes);
+        free(bv->rows);
         free(bv);
     }
 }
 
-void bundle_vectors(BoundVectors* bound, BundledVector* bundle) {
-    // Reset sum vector
-    for (int j = 0; j < bundle->dimension; j++) {
-        bundle->sum_vector[j] = 0;
+/*
+ * Bit-sliced counting. With one plane per binary digit, adding a bound row
+ * to the counts of 64 dimensions is a ripple-carry add over whole words.
+ * Rows are added in blocks of 8 through a carry-save adder tree (as in the
+ * Harley-Seal popcount): planes 0-2 absorb the block with 7 full adders,
+ * and only the resulting carry of weight 8 ripples into the higher planes.
+ */
+
+// Add 'carry' to the counts starting at plane 'first'
+static inline void ripple_add(uint64_t* planes, int n_planes, int words, int w, int first, 
+                              uint64_t carry) {
+    for (int p = first; p < n_planes && carry; p++) {
+        uint64_t* plane = planes + (size_t)p * words;
+        uint64_t next = plane[w] & carry;
+        plane[w] ^= carry;
+        carry = next;
     }
+}
+
+// Add HD_BUNDLE_BLOCK rows at once
+static void add_row_block(uint64_t* planes, int n_planes, int words, const uint64_t* const* rows) {
+    uint64_t* ones = planes;
+    uint64_t* twos = planes + words;
+    uint64_t* fours = planes + 2 * words;
+
+    for (int w = 0; w < words; w++) {
+        uint64_t o = ones[w], t = twos[w], f = fours[w];
+        uint64_t twos_a, twos_b, fours_a, fours_b, eights;
+
+        carry_save_add(&twos_a, &o, o, rows[0][w], rows[1][w]);
+        carry_save_add(&twos_b, &o, o, rows[2][w], rows[3][w]);
+        carry_save_add(&fours_a, &t, t, twos_a, twos_b);
+        carry_save_add(&twos_a, &o, o, rows[4][w], rows[5][w]);
+        carry_save_add(&twos_b, &o, o, rows[6][w], rows[7][w]);
+        carry_save_add(&fours_b, &t, t, twos_a, twos_b);
+        carry_save_add(&eights, &f, f, fours_a, fours_b);
+
+        ones[w] = o;
+        twos[w] = t;
+        fours[w] = f;
+        ripple_add(planes, n_planes, words, w, 3, eights);
+    }
+}
+
+// Clear the counters for up to n_rows rows
+static void begin_counting(BundledVector* bundle, int n_rows) {
+    int words = HD_WORDS(bundle->dimension);
+    int n_planes = counter_planes(n_rows);
+
+    bundle->n_planes = n_planes;
+    bundle->n_pending = 0;
+    memset(bundle->planes, 0, (size_t)n_planes * words * sizeof(uint64_t));
+}
+
+// Scratch row to bind the next feature into (pass it to push_row)
+static inline uint64_t* next_row(BundledVector* bundle) {
+    return bundle->rows + (size_t)bundle->n_pending * HD_WORDS(bundle->dimension);
+}
+
+// Queue a bound row; full blocks are counted right away. The row must stay
+// valid until then (scratch rows from next_row or rows of a stored table).
+static inline void push_row(BundledVector* bundle, const uint64_t* row) {
+    bundle->pending[bundle->n_pending++] = row;
+    if (bundle->n_pending == HD_BUNDLE_BLOCK) {
+        add_row_block(bundle->planes, bundle->n_planes, HD_WORDS(bundle->dimension), 
+                      bundle->pending);
+        bundle->n_pending = 0;
+    }
+}
+
+// Count the remaining rows and set final_vector to (count > threshold),
+// compared bit-sliced from the top plane down
+static void finish_counting(BundledVector* bundle, int threshold) {
+    int words = HD_WORDS(bundle->dimension);
+    int n_planes = bundle->n_planes;
+    const uint64_t* planes = bundle->planes;
+
+    for (int r = 0; r < bundle->n_pending; r++) {
+        for (int w = 0; w < words; w++) {
+            ripple_add(bundle->planes, n_planes, words, w, 0, bundle->pending[r][w]);
+        }
+    }
+    bundle->n_pending = 0;
+
+    for (int w = 0; w < words; w++) {
+        uint64_t greater = 0;
+        uint64_t equal = ~(uint64_t)0;
+        for (int p = n_planes - 1; p >= 0; p--) {
+            uint64_t bits = planes[(size_t)p * words + w];
+            if ((threshold >> p) & 1) {
+                equal &= bits;
+            } else {
+                greater |= equal & bits;
+                equal &= ~bits;
+            }
+        }
+        bundle->final_vector[w] = greater;
+    }
+    bundle->final_vector[words - 1] &= hd_tail_mask(bundle->dimension);
+}
+
+// Fill sum_vector from the bit-sliced counters of the last bundling. Only
+// needed by callers that read the counts; encoding itself never does.
+void decode_bundle_counts(BundledVector* bundle) {
+    int words = HD_WORDS(bundle->dimension);
+
+    for (int w = 0; w < words; w++) {
+        int* counters = bundle->sum_vector + w * HD_WORD_BITS;
+        for (int b = 0; b < HD_WORD_BITS; b++) {
+            int count = 0;
+            for (int p = 0; p < bundle->n_planes; p++) {
+                count |= (int)((bundle->planes[(size_t)p * words + w] >> b) & 1u) << p;
+            }
+            counters[b] = count;
+        }
+    }
+}
+
+void bundle_vectors(BoundVectors* bound, BundledVector* bundle) {
+    begin_counting(bundle, bound->feature_dimension);
     
     // Accumulation process - for binary encoding (0,1)
     for (int i = 0; i < bound->feature_dimension; i++) {
-        for (int j = 0; j < bundle->dimension; j++) {
-            bundle->sum_vector[j] += bound->bound_vectors[i][j];
-        }
+        push_row(bundle, bound->bound_vectors[i]);
     }
     
     // Majority voting for binary encoding (threshold at n/2)
-    int threshold = bound->feature_dimension / 2;
-    for (int i = 0; i < bundle->dimension; i++) {
-        bundle->final_vector[i] = (bundle->sum_vector[i] > threshold) ? 1 : 0;
+    finish_counting(bundle, bound->feature_dimension / 2);
+    decode_bundle_counts(bundle);
+}
+
+// Fused binding and bundling: each bound row only lives in the block
+// scratch until it is counted, so no per-feature bound vectors are stored
+void bind_and_bundle(const unsigned char* features, HDLevelVectors* hd, HDMapping* mapping,
+                     const uint64_t* item_memory, int feature_dimension, BundledVector* bundle) {
+    int words = HD_WORDS(bundle->dimension);
+    int stride = HD_ROW_WORDS(bundle->dimension);
+
+    // Value-to-level-vector table, if the mapping was attached to these levels
+    uint64_t* const* level_lut = mapping->level_source == hd ? mapping->vector_lut : NULL;
+
+    begin_counting(bundle, feature_dimension);
+
+    for (int i = 0; i < feature_dimension; i++) {
+        const uint64_t* level_vector = level_lut ? level_lut[features[i]] 
+                                                 : get_level_vector(hd, features[i], mapping);
+        const uint64_t* item_vector = hd_row(item_memory, stride, i);
+        uint64_t* bound = next_row(bundle);
+
+        for (int w = 0; w < words; w++) {
+            bound[w] = level_vector[w] ^ item_vector[w];
+        }
+        push_row(bundle, bound);
+    }
+
+    // Majority voting for binary encoding (threshold at n/2)
+    finish_counting(bundle, feature_dimension / 2);
+}
+
+// Same as bind_and_bundle, but item vector i is regenerated word by word
+// from (item_seed, i) instead of being read from an item memory table.
+// Bits past the dimension only reach padding counters, which thresholding
+// masks off, so the result equals bind_and_bundle on the generated table.
+void bind_and_bundle_seeded(const unsigned char* features, HDLevelVectors* hd, HDMapping* mapping,
+                            uint64_t item_seed, int feature_dimension, BundledVector* bundle) {
+    int words = HD_WORDS(bundle->dimension);
+    uint64_t* const* level_lut = mapping->level_source == hd ? mapping->vector_lut : NULL;
+
+    begin_counting(bundle, feature_dimension);
+
+    for (int i = 0; i < feature_dimension; i++) {
+        const uint64_t* level_vector = level_lut ? level_lut[features[i]] 
+                                                 : get_level_vector(hd, features[i], mapping);
+        uint64_t item_key = hd_stream_key(item_seed, HD_STREAM_ITEM | (uint32_t)i);
+        uint64_t* bound = next_row(bundle);
+
+        for (int w = 0; w < words; w++) {
+            bound[w] = level_vector[w] ^ hd_random_word(item_key, w);
+        }
+        push_row(bundle, bound);
+    }
+
+    finish_counting(bundle, feature_dimension / 2);
+}
+
+// Bundling from a bound table (see fill_bound_table): binding is a row
+// lookup, and the precomputed rows go into the adder tree without a copy
+void bundle_bound_rows(const unsigned char* features, HDMapping* mapping,
+                       const uint64_t* bound_table, int levels, int feature_dimension,
+                       BundledVector* bundle) {
+    int stride = HD_ROW_WORDS(bundle->dimension);
+
+    begin_counting(bundle, feature_dimension);
+
+    for (int i = 0; i < feature_dimension; i++) {
+        push_row(bundle, bound_row(bound_table, stride, levels, i,
+                                   get_level_index(mapping, features[i])));
+    }
+
+    finish_counting(bundle, feature_dimension / 2);
+}
+
+// Permutation (rho) positional binding: feature i contributes its level
+// vector rotated by i bits, so no item vectors exist at all. 'doubled_levels'
+// holds the doubled copy of every level vector (see double_hypervector),
+// 'doubled_stride' words apart. Positions stay distinct while
+// feature_dimension <= dimension.
+void bind_and_bundle_permuted(const unsigned char* features, HDMapping* mapping,
+                              const uint64_t* doubled_levels, int doubled_stride,
+                              int feature_dimension, BundledVector* bundle) {
+    int dimension = bundle->dimension;
+    int words = HD_WORDS(dimension);
+
+    begin_counting(bundle, feature_dimension);
+
+    for (int i = 0; i < feature_dimension; i++) {
+        int level = get_level_index(mapping, features[i]);
+        const uint64_t* doubled = hd_row(doubled_levels, doubled_stride, level);
+        int shift = i % dimension;
+        uint64_t* bound = next_row(bundle);
+
+        for (int w = 0; w < words; w++) {
+            bound[w] = rotated_word(doubled, shift, w);
+        }
+        push_row(bundle, bound);
     }
+
+    finish_counting(bundle, feature_dimension / 2);
 }
 
 void print_bundling_result(BundledVector* bundle) {
+    decode_bundle_counts(bundle);
     printf("\nBundling result sample (first 20 elements):\n");
     printf("Sum values: ");
     for (int i = 0; i < 20; i++) {
@@ -65,18 +281,15 @@ void print_bundling_result(BundledVector* bundle) {
 
     printf("Binarized result: ");
     for (int i = 0; i < 20; i++) {
-        printf("%d ", bundle->final_vector[i]);
+        printf("%d ", hd_get_bit(bundle->final_vector, i));
     }
     printf("...\n");
 
     // Count ones
-    int ones = 0;
-    for (int i = 0; i < bundle->dimension; i++) {
-        if (bundle->final_vector[i] == 1) ones++;
-    }
+    int ones = count_ones(bundle->final_vector, bundle->dimension);
     printf("\nStatistics:\n");
     printf("Number of 1s: %d (%.2f%%)\n", ones, (float)ones * 100 / bundle->dimension);
     printf("Number of 0s: %d (%.2f%%)\n", 
            bundle->dimension - ones, 
            (float)(bundle->dimension - ones) * 100 / bundle->dimension);
-}
\ No newline at end of file
+}
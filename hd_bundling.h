@@ -3,17 +3,53 @@
 
 #include "hd_binding.h"
 
-// Structure to store bundling results
+// Bound rows are counted 8 at a time by a carry-save adder tree
+#define HD_BUNDLE_BLOCK 8
+#define HD_MAX_COUNTER_PLANES 31   // Enough bits for any int count
+
+// Structure to store bundling results. Votes are counted bit-sliced: plane p
+// holds bit p of the count of all 64 dimensions of a word, so one bitwise
+// operation updates 64 counters at once.
 typedef struct {
     int dimension;        // Vector dimension
-    int* sum_vector;      // Accumulator for bundling
-    char* final_vector;   // Final binarized result
+    int* sum_vector;      // Per-dimension counts (padded to whole words), see decode_bundle_counts
+    uint64_t* final_vector; // Final binarized result (packed)
+    uint64_t* planes;     // HD_MAX_COUNTER_PLANES planes of HD_WORDS(dimension) words
+    int n_planes;         // Planes used by the current count
+    uint64_t* rows;       // Scratch for HD_BUNDLE_BLOCK bound rows
+    const uint64_t* pending[HD_BUNDLE_BLOCK]; // Rows waiting to be counted
+    int n_pending;
 } BundledVector;
 
+// Full adder over 64 lanes: a + b + c = 2 * high + low
+static inline void carry_save_add(uint64_t* high, uint64_t* low, uint64_t a, uint64_t b, 
+                                  uint64_t c) {
+    uint64_t u = a ^ b;
+    *high = (a & b) | (u & c);
+    *low = u ^ c;
+}
+
+// Binary digits needed to count up to n rows, and at least the three planes
+// the adder tree writes
+static inline int counter_planes(int n) {
+    return n < 8 ? 3 : 32 - __builtin_clz((unsigned)n);
+}
+
 // Function declarations
 BundledVector* init_bundled_vector(int dimension);
 void free_bundled_vector(BundledVector* bv);
 void bundle_vectors(BoundVectors* bound, BundledVector* bundle);
+void bind_and_bundle(const unsigned char* features, HDLevelVectors* hd, HDMapping* mapping,
+                     const uint64_t* item_memory, int feature_dimension, BundledVector* bundle);
+void bind_and_bundle_seeded(const unsigned char* features, HDLevelVectors* hd, HDMapping* mapping,
+                            uint64_t item_seed, int feature_dimension, BundledVector* bundle);
+void bundle_bound_rows(const unsigned char* features, HDMapping* mapping,
+                       const uint64_t* bound_table, int levels, int feature_dimension,
+                       BundledVector* bundle);
+void bind_and_bundle_permuted(const unsigned char* features, HDMapping* mapping,
+                              const uint64_t* doubled_levels, int doubled_stride,
+                              int feature_dimension, BundledVector* bundle);
+void decode_bundle_counts(BundledVector* bundle);
 void print_bundling_result(BundledVector* bundle);
 
 #endif // HD_BUNDLING_H
\ No newline at end of file
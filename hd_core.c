@@ -1,35 +1,39 @@
 // hd_core.c - Implementation of the high-level HD Computing API
 #include "hd_core.h"
+#include "hd_popcount.h"
+#include "hd_model.h"
+#include "hd_random.h"
+#include "hd_hash.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <time.h>
 #include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
-// Generate item memory with improved error handling
-static char** generate_item_memory(int feature_dimension, int dimension) {
-    char** item_memory = (char**)malloc(feature_dimension * sizeof(char*));
+// Bytes taken by the item memory table inside the model arena
+static size_t item_memory_bytes(int feature_dimension, int dimension) {
+    return arena_footprint((size_t)feature_dimension * HD_ROW_WORDS(dimension) * sizeof(uint64_t));
+}
+
+// Generate item memory with improved error handling. Row i depends only on
+// (seed, i), so any single item vector can be regenerated on its own.
+static uint64_t* generate_item_memory(HDArena* arena, int feature_dimension, int dimension,
+                                      uint64_t seed) {
+    int stride = HD_ROW_WORDS(dimension);
+    uint64_t* item_memory = (uint64_t*)arena_alloc(arena, (size_t)feature_dimension * stride * 
+                                                          sizeof(uint64_t));
     if (!item_memory) {
         printf("Failed to allocate item memory array\n");
         return NULL;
     }
 
-    // Initialize each item vector
+    // Initialize each item vector, 64 random bits at a time
     for (int i = 0; i < feature_dimension; i++) {
-        item_memory[i] = (char*)malloc(dimension * sizeof(char));
-        if (!item_memory[i]) {
-            printf("Failed to allocate item memory vector %d\n", i);
-            // Clean up previously allocated memory
-            for (int j = 0; j < i; j++) {
-                free(item_memory[j]);
-            }
-            free(item_memory);
-            return NULL;
-        }
-
-        // Generate random binary values (0 or 1)
-        for (int j = 0; j < dimension; j++) {
-            item_memory[i][j] = rand() % 2;
-        }
+        generate_item_vector(hd_row(item_memory, stride, i), dimension, seed, i);
     }
 
     // Debug output for verification
@@ -37,7 +41,7 @@ static char** generate_item_memory(int feature_dimension, int dimension) {
         for (int i = 0; i < 3 && i < feature_dimension; i++) {
             printf("Item memory[%d] first 5 elements: ", i);
             for (int j = 0; j < 5 && j < dimension; j++) {
-                printf("%d ", item_memory[i][j]);
+                printf("%d ", hd_get_bit(hd_row(item_memory, stride, i), j));
             }
             printf("\n");
         }
@@ -46,9 +50,108 @@ static char** generate_item_memory(int feature_dimension, int dimension) {
     return item_memory;
 }
 
-// Initialize the HD computing context
+// Precompute level XOR item for every (feature, level) pair when the table
+// fits in HD_BOUND_TABLE_MAX_BYTES; otherwise the encoders bind on the fly
+static void init_bound_table(HDContext* context) {
+    context->bound_table = NULL;
+    if (context->item_mode != HD_ITEM_TABLE) return;
+    
+    size_t bytes = bound_table_bytes(context->levels, context->feature_dimension, 
+                                     context->dimension);
+    if (bytes > (size_t)HD_BOUND_TABLE_MAX_BYTES) {
+        printf("Bound table: %zu KB exceeds budget, binding on the fly\n", bytes / 1024);
+        return;
+    }
+    
+    context->bound_table = (uint64_t*)aligned_alloc(HD_ALIGNMENT, bytes);
+    if (!context->bound_table) {
+        printf("Failed to allocate bound table, binding on the fly\n");
+        return;
+    }
+    fill_bound_table(context->bound_table, context->level_vectors, context->item_memory,
+                     context->feature_dimension);
+    printf("Bound table: %d x %d rows (%zu KB)\n", 
+           context->feature_dimension, context->levels, bytes / 1024);
+}
+
+// Encoder workspace for the context's item mode
+static HDEncoder* new_context_encoder(HDContext* context) {
+    HDEncoder* encoder = init_item_encoder(context->level_vectors, context->mapping, 
+                                           context->item_mode, context->item_memory, 
+                                           context->seed, context->feature_dimension);
+    if (encoder) {
+        attach_bound_table(encoder, context->bound_table);
+    }
+    return encoder;
+}
+
+// Start the thread pool and one encoder workspace per thread. Thread 0 is
+// the caller and shares the context's own encoder.
+static int start_workers(HDContext* context, int n_threads) {
+    context->pool = init_thread_pool(n_threads);
+    if (!context->pool) return 0;
+    context->num_threads = context->pool->n_threads;
+    
+    context->thread_encoders = (HDEncoder**)calloc(context->num_threads, sizeof(HDEncoder*));
+    if (!context->thread_encoders) {
+        free_thread_pool(context->pool);
+        context->pool = NULL;
+        return 0;
+    }
+    
+    context->thread_encoders[0] = context->encoder;
+    for (int t = 1; t < context->num_threads; t++) {
+        context->thread_encoders[t] = new_context_encoder(context);
+        if (!context->thread_encoders[t]) {
+            for (int j = 1; j < t; j++) {
+                free_encoder(context->thread_encoders[j]);
+            }
+            free(context->thread_encoders);
+            context->thread_encoders = NULL;
+            free_thread_pool(context->pool);
+            context->pool = NULL;
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void stop_workers(HDContext* context) {
+    if (context->thread_encoders) {
+        for (int t = 1; t < context->num_threads; t++) {
+            free_encoder(context->thread_encoders[t]);
+        }
+        free(context->thread_encoders);
+        context->thread_encoders = NULL;
+    }
+    free_thread_pool(context->pool);
+    context->pool = NULL;
+}
+
+// Initialize the HD computing context with the configured seed (HD_SEED)
 HDContext* hd_init(int dimension, int levels, float randomness, 
                   int feature_dimension, int n_classes, const char* dataset_name) {
+    return hd_init_with_seed(dimension, levels, randomness, feature_dimension, n_classes,
+                             dataset_name, HD_SEED);
+}
+
+HDContext* hd_init_with_seed(int dimension, int levels, float randomness, 
+                             int feature_dimension, int n_classes, const char* dataset_name,
+                             uint64_t seed) {
+    return hd_init_with_items(dimension, levels, randomness, feature_dimension, n_classes,
+                              dataset_name, seed, HD_ITEM_MODE);
+}
+
+// Initialize the HD computing context. The level vectors and item memory are
+// a pure function of the seed (0 = pick one from the clock).
+HDContext* hd_init_with_items(int dimension, int levels, float randomness, 
+                              int feature_dimension, int n_classes, const char* dataset_name,
+                              uint64_t seed, HDItemMode item_mode) {
+    if ((unsigned)item_mode >= HD_ITEM_MODE_COUNT) {
+        printf("Invalid item memory mode %d\n", (int)item_mode);
+        return NULL;
+    }
+    
     // Allocate context structure
     HDContext* context = (HDContext*)malloc(sizeof(HDContext));
     if (!context) {
@@ -62,19 +165,45 @@ HDContext* hd_init(int dimension, int levels, float randomness,
     context->randomness = randomness;
     context->feature_dimension = feature_dimension;
     context->n_classes = n_classes;
+    context->item_mode = item_mode;
+    context->item_memory = NULL;
     context->is_initialized = 0;
     context->is_trained = 0;
+    context->mapped_model = NULL;
+    context->mapped_size = 0;
+    memset(context->encoded_cache, 0, sizeof(context->encoded_cache));
+    context->encoded_cache_next = 0;
+    context->spill_dir[0] = '\0';
+    hd_set_encoding_cache(context, HD_ENCODING_CACHE, HD_ENCODING_SPILL_DIR);
     
     // Copy dataset name
     strncpy(context->dataset_name, dataset_name, sizeof(context->dataset_name)-1);
     
-    // Initialize random number generator
-    srand((unsigned int)time(NULL));
+    // Resolve the seed so the model can be reproduced
+    context->seed = hd_resolve_seed(seed);
+    printf("Model seed: %llu\n", (unsigned long long)context->seed);
+    
+    // Select the Hamming distance kernel for this CPU
+    hd_popcount_init();
+    printf("Hamming distance kernel: %s\n", 
+           hd_popcount_backend_name(hd_popcount_get_backend()));
+    
+    // Level vectors, item memory and class vectors share one aligned arena
+    size_t item_bytes = item_mode == HD_ITEM_TABLE ? item_memory_bytes(feature_dimension, dimension) : 0;
+    context->arena = init_arena(level_vectors_bytes(levels, dimension) + item_bytes +
+                                class_vectors_bytes(n_classes, dimension));
+    if (!context->arena) {
+        printf("Failed to allocate model memory\n");
+        free(context);
+        return NULL;
+    }
     
     // Initialize HD level vectors
-    context->level_vectors = init_level_vectors(levels, dimension, randomness);
+    context->level_vectors = init_level_vectors(levels, dimension, randomness, context->seed,
+                                                context->arena);
     if (!context->level_vectors) {
         printf("Failed to initialize HD level vectors\n");
+        free_arena(context->arena);
         free(context);
         return NULL;
     }
@@ -84,30 +213,76 @@ HDContext* hd_init(int dimension, int levels, float randomness,
     if (!context->mapping) {
         printf("Failed to initialize HD mapping\n");
         free_level_vectors(context->level_vectors);
+        free_arena(context->arena);
         free(context);
         return NULL;
     }
+    // Resolve pixel values straight to level vectors
+    attach_level_vectors(context->mapping, context->level_vectors);
     
-    // Generate item memory
-    context->item_memory = generate_item_memory(feature_dimension, dimension);
-    if (!context->item_memory) {
+    // Generate item memory (procedural items are regenerated by the encoder)
+    if (item_mode == HD_ITEM_TABLE) {
+        context->item_memory = generate_item_memory(context->arena, feature_dimension, dimension,
+                                                    context->seed);
+    } else if (item_mode == HD_ITEM_PROCEDURAL) {
+        printf("Item memory: procedural (%d vectors regenerated from the seed)\n", 
+               feature_dimension);
+    } else {
+        printf("Item memory: none (feature positions encoded by rotation)\n");
+        if (feature_dimension > dimension) {
+            printf("Warning: %d features but only %d distinct rotations\n", 
+                   feature_dimension, dimension);
+        }
+    }
+    if (item_mode == HD_ITEM_TABLE && !context->item_memory) {
         printf("Failed to generate item memory\n");
         free_mapping(context->mapping);
         free_level_vectors(context->level_vectors);
+        free_arena(context->arena);
         free(context);
         return NULL;
     }
     
     // Initialize class vectors (will be populated during training)
-    context->class_vectors = init_class_vectors(n_classes, dimension);
+    context->class_vectors = init_class_vectors(n_classes, dimension, context->arena);
     if (!context->class_vectors) {
         printf("Failed to initialize class vectors\n");
-        for (int i = 0; i < feature_dimension; i++) {
-            free(context->item_memory[i]);
-        }
-        free(context->item_memory);
         free_mapping(context->mapping);
         free_level_vectors(context->level_vectors);
+        free_arena(context->arena);
+        free(context);
+        return NULL;
+    }
+    
+    // Binding lookup table for few levels
+    init_bound_table(context);
+    
+    // Create the encoder workspace shared by the serial code paths
+    context->encoder = new_context_encoder(context);
+    if (!context->encoder) {
+        printf("Failed to initialize encoder workspace\n");
+        free(context->bound_table);
+        free_class_vectors(context->class_vectors);
+        free_mapping(context->mapping);
+        free_level_vectors(context->level_vectors);
+        free_arena(context->arena);
+        free(context);
+        return NULL;
+    }
+    printf("Encoding kernels: %s\n", 
+           context->encoder->kernels ? context->encoder->kernels->name : "generic");
+    
+    // Start the worker pool used by training and batch inference
+    context->pool = NULL;
+    context->thread_encoders = NULL;
+    if (!start_workers(context, hd_default_thread_count())) {
+        printf("Failed to start thread pool\n");
+        free_encoder(context->encoder);
+        free(context->bound_table);
+        free_class_vectors(context->class_vectors);
+        free_mapping(context->mapping);
+        free_level_vectors(context->level_vectors);
+        free_arena(context->arena);
         free(context);
         return NULL;
     }
@@ -122,19 +297,20 @@ HDContext* hd_init(int dimension, int levels, float randomness,
 void hd_free(HDContext* context) {
     if (!context) return;
     
+    // Stop the worker threads
+    stop_workers(context);
+    
+    hd_clear_encoding_cache(context);
+    
+    // Free the encoder workspace
+    free_encoder(context->encoder);
+    free(context->bound_table);
+    
     // Free class vectors
     if (context->class_vectors) {
         free_class_vectors(context->class_vectors);
     }
     
-    // Free item memory
-    if (context->item_memory) {
-        for (int i = 0; i < context->feature_dimension; i++) {
-            free(context->item_memory[i]);
-        }
-        free(context->item_memory);
-    }
-    
     // Free mapping and level vectors
     if (context->mapping) {
         free_mapping(context->mapping);
@@ -144,45 +320,394 @@ void hd_free(HDContext* context) {
         free_level_vectors(context->level_vectors);
     }
     
+    // Release the model tensors (level vectors, item memory, class vectors)
+    free_arena(context->arena);
+    if (context->mapped_model) {
+        munmap(context->mapped_model, context->mapped_size);
+    }
+    
     // Free the context itself
     free(context);
 }
 
+// Change the number of worker threads (0 = HD_NUM_THREADS / all CPUs)
+int hd_set_num_threads(HDContext* context, int n_threads) {
+    if (!context) {
+        printf("Invalid parameters for thread configuration\n");
+        return 0;
+    }
+    
+    stop_workers(context);
+    if (!start_workers(context, n_threads)) {
+        printf("Failed to start thread pool with %d threads\n", n_threads);
+        return 0;
+    }
+    return 1;
+}
+
+int hd_set_encoding_cache(HDContext* context, int enabled, const char* spill_dir) {
+    if (!context) {
+        printf("Invalid parameters for encoding cache\n");
+        return 0;
+    }
+    
+    if (!spill_dir) {
+        spill_dir = "";
+    }
+    if (strlen(spill_dir) >= sizeof(context->spill_dir)) {
+        printf("Spill directory name too long: %s\n", spill_dir);
+        return 0;
+    }
+    
+    // Cached sets may live in the old spill directory
+    if (!enabled || strcmp(spill_dir, context->spill_dir) != 0) {
+        hd_clear_encoding_cache(context);
+    }
+    
+    context->cache_encodings = enabled;
+    snprintf(context->spill_dir, sizeof(context->spill_dir), "%s", spill_dir);
+    
+    if (enabled && spill_dir[0] != '\0' && mkdir(spill_dir, 0755) != 0 && errno != EEXIST) {
+        printf("Cannot create spill directory %s, keeping encodings in RAM\n", spill_dir);
+        context->spill_dir[0] = '\0';
+    }
+    return 1;
+}
+
+void hd_clear_encoding_cache(HDContext* context) {
+    if (context) {
+        for (int i = 0; i < HD_ENCODED_CACHE_SLOTS; i++) {
+            free_encoded_set(context->encoded_cache[i]);
+            context->encoded_cache[i] = NULL;
+        }
+        context->encoded_cache_next = 0;
+    }
+}
+
+// Encode a single sample into caller-provided storage (no allocation)
+int hd_encode_into(HDContext* context, const unsigned char* features, uint64_t* result) {
+    if (!context || !features || !result || !context->encoder) {
+        printf("Invalid parameters for sample encoding\n");
+        return 0;
+    }
+    
+    encode_features(context->encoder, features, result);
+    return 1;
+}
+
 // Encode a single sample using HD computing operations
 void hd_encode_sample(HDContext* context, unsigned char* features, BundledVector** result) {
     if (!context || !features || !result) {
         printf("Invalid parameters for sample encoding\n");
-        *result = NULL;
-        return;
-    }
-    
-    // Initialize bound vectors
-    BoundVectors* bound = init_bound_vectors(context->dimension, context->feature_dimension);
-    if (!bound) {
-        printf("Failed to initialize bound vectors for sample encoding\n");
-        *result = NULL;
+        if (result) *result = NULL;
         return;
     }
     
-    // Bind the features
-    bind_features(features, context->level_vectors, context->mapping, 
-                 context->item_memory, bound);
-    
-    // Bundle the bound vectors
+    // Allocate the result (the caller owns it)
     BundledVector* bundle = init_bundled_vector(context->dimension);
     if (!bundle) {
         printf("Failed to initialize bundle vector for sample encoding\n");
-        free_bound_vectors(bound);
         *result = NULL;
         return;
     }
     
-    bundle_vectors(bound, bundle);
-    free_bound_vectors(bound);
+    // Fused binding and bundling straight into the result's counters
+    bundle_features(context->encoder, features, bundle);
+    decode_bundle_counts(bundle);
     
     *result = bundle;
 }
 
+// Shared state for encoding a run of samples into an encoded set
+typedef struct {
+    HDContext* context;
+    const unsigned char* features;
+    int feature_stride;
+    HDEncodedSet* encoded;
+} EncodeJob;
+
+static void encode_range(void* arg, int begin, int end, int thread_id) {
+    EncodeJob* job = (EncodeJob*)arg;
+    HDEncoder* encoder = job->context->thread_encoders[thread_id];
+    
+    for (int i = begin; i < end; i++) {
+        encode_features(encoder, job->features + (size_t)i * job->feature_stride, 
+                        encoded_row(job->encoded, i));
+    }
+}
+
+// Hashes of the samples, HD_BATCH_CHUNK per block. The blocks do not depend
+// on the thread count, so the key of a spill file stays the same across runs.
+typedef struct {
+    const unsigned char* features;
+    int feature_stride;
+    int feature_dimension;
+    int n_samples;
+    HDHash* block_hashes;
+} HashJob;
+
+static void hash_sample_block(const HashJob* job, int block, HDHash* hash) {
+    int begin = block * HD_BATCH_CHUNK;
+    int end = begin + HD_BATCH_CHUNK < job->n_samples ? begin + HD_BATCH_CHUNK : job->n_samples;
+    
+    hd_hash_init(hash, HD_HASH_SEED);
+    for (int i = begin; i < end; i++) {
+        hd_hash_words(hash, job->features + (size_t)i * job->feature_stride, 
+                      job->feature_dimension);
+    }
+}
+
+static void hash_range(void* arg, int begin, int end, int thread_id) {
+    (void)thread_id;
+    HashJob* job = (HashJob*)arg;
+    
+    for (int b = begin; b < end; b++) {
+        hash_sample_block(job, b, &job->block_hashes[b]);
+    }
+}
+
+// Cache key and check hash: everything the encoding depends on (dimensions,
+// level and item tables or item seed, value-to-level mapping) plus the sample
+// content itself, hashed block by block on the pool and combined in order
+static void encoding_key(HDContext* context, const unsigned char* features, int feature_stride, 
+                         int n_samples, uint64_t* key, uint64_t* check) {
+    size_t row_bytes = (size_t)HD_WORDS(context->dimension) * sizeof(uint64_t);
+    int stride = HD_ROW_WORDS(context->dimension);
+    int header[4] = { context->dimension, context->levels, context->feature_dimension, n_samples };
+    HDHash hash;
+    
+    hd_hash_init(&hash, HD_HASH_SEED);
+    hd_hash_words(&hash, header, sizeof(header));
+    for (int l = 0; l < context->levels; l++) {
+        hd_hash_words(&hash, level_vector(context->level_vectors, l), row_bytes);
+    }
+    if (context->item_mode == HD_ITEM_TABLE) {
+        for (int f = 0; f < context->feature_dimension; f++) {
+            hd_hash_words(&hash, hd_row(context->item_memory, stride, f), row_bytes);
+        }
+    } else {
+        int32_t item_mode = (int32_t)context->item_mode;
+        hd_hash_words(&hash, &item_mode, sizeof(item_mode));
+        hd_hash_words(&hash, &context->seed, sizeof(context->seed));
+    }
+    hd_hash_words(&hash, context->mapping->level_lut, sizeof(context->mapping->level_lut));
+    
+    int n_blocks = (n_samples + HD_BATCH_CHUNK - 1) / HD_BATCH_CHUNK;
+    HashJob job = { features, feature_stride, context->feature_dimension, n_samples, NULL };
+    job.block_hashes = (HDHash*)malloc((size_t)(n_blocks > 0 ? n_blocks : 1) * sizeof(HDHash));
+    if (job.block_hashes && thread_pool_for(context->pool, n_blocks, 1, hash_range, &job)) {
+        for (int b = 0; b < n_blocks; b++) {
+            hd_hash_combine(&hash, &job.block_hashes[b]);
+        }
+    } else {
+        // Same blocks, hashed on this thread
+        for (int b = 0; b < n_blocks; b++) {
+            HDHash block;
+            hash_sample_block(&job, b, &block);
+            hd_hash_combine(&hash, &block);
+        }
+    }
+    free(job.block_hashes);
+    
+    *key = hash.a;
+    *check = hash.b;
+}
+
+// Encoded rows of n_samples samples. With the cache enabled the set is
+// looked up by key (in RAM, then in the spill directory) and encoded only on
+// a miss; otherwise a private set is encoded. Release with release_encodings.
+static HDEncodedSet* acquire_encodings(HDContext* context, const unsigned char* features, 
+                                       int feature_stride, int n_samples) {
+    if (!context->cache_encodings) {
+        HDEncodedSet* set = init_encoded_set(0, 0, n_samples, context->dimension);
+        EncodeJob job = { context, features, feature_stride, set };
+        if (set && !thread_pool_for(context->pool, n_samples, HD_BATCH_CHUNK, encode_range, &job)) {
+            free_encoded_set(set);
+            return NULL;
+        }
+        return set;
+    }
+    
+    uint64_t key, check;
+    encoding_key(context, features, feature_stride, n_samples, &key, &check);
+    for (int i = 0; i < HD_ENCODED_CACHE_SLOTS; i++) {
+        HDEncodedSet* cached = context->encoded_cache[i];
+        if (cached && cached->key == key && cached->check == check && 
+            cached->n_samples == n_samples && 
+            cached->dimension == context->dimension) {
+            return cached;
+        }
+    }
+    
+    HDEncodedSet* set = NULL;
+    int filled = 0;
+    if (context->spill_dir[0] != '\0') {
+        char path[sizeof(context->spill_dir) + 48];
+        snprintf(path, sizeof(path), "%s/encoded_%016llx.bin", 
+                 context->spill_dir, (unsigned long long)key);
+        set = open_encoded_spill(path, key, check, n_samples, context->dimension);
+        filled = set != NULL;
+        if (filled) {
+            printf("Using encoded samples from %s\n", path);
+        } else {
+            set = create_encoded_spill(path, key, check, n_samples, context->dimension);
+        }
+    }
+    if (!set) {
+        set = init_encoded_set(key, check, n_samples, context->dimension);
+        if (!set) return NULL;
+    }
+    
+    if (!filled) {
+        EncodeJob job = { context, features, feature_stride, set };
+        if (!thread_pool_for(context->pool, n_samples, HD_BATCH_CHUNK, encode_range, &job)) {
+            free_encoded_set(set);
+            return NULL;
+        }
+        // A failed commit only loses the file; the rows stay mapped
+        if (set->mapped) {
+            commit_encoded_spill(set);
+        }
+    }
+    
+    // Round-robin replacement
+    int slot = context->encoded_cache_next;
+    free_encoded_set(context->encoded_cache[slot]);
+    context->encoded_cache[slot] = set;
+    context->encoded_cache_next = (slot + 1) % HD_ENCODED_CACHE_SLOTS;
+    return set;
+}
+
+static void release_encodings(HDContext* context, HDEncodedSet* set) {
+    for (int i = 0; i < HD_ENCODED_CACHE_SLOTS; i++) {
+        if (context->encoded_cache[i] == set) return;
+    }
+    free_encoded_set(set);
+}
+
+// Shared state for one parallel training run
+typedef struct {
+    HDContext* context;
+    const unsigned char* features;  // Samples of the current batch
+    int feature_stride;
+    const unsigned char* labels;
+    int n_samples;
+    int show_progress;
+    const HDEncodedSet* encoded;    // Cached encodings of the batch (NULL = encode here)
+    ClassVectors** partials;    // Per-thread class accumulators
+} TrainJob;
+
+// Encode and accumulate one contiguous shard of the current batch
+static void train_shard_task(void* arg, int thread_id, int n_threads) {
+    TrainJob* job = (TrainJob*)arg;
+    HDEncoder* encoder = job->context->thread_encoders[thread_id];
+    ClassVectors* partial = job->partials[thread_id];
+    
+    int begin, end;
+    thread_pool_shard(job->n_samples, thread_id, n_threads, &begin, &end);
+    int progress_step = (end - begin) / 20 > 0 ? (end - begin) / 20 : 1;
+    
+    for (int i = begin; i < end; i++) {
+        // Show progress (reported by the calling thread for its own shard)
+        if (job->show_progress && thread_id == 0 && (i - begin) % progress_step == 0) {
+            printf("Training progress: %.1f%% (%d/%d)\n", 
+                   (float)(i - begin) * 100 / (end - begin), 
+                   i - begin, end - begin);
+        }
+        
+        // Encode the current sample into this thread's workspace
+        const uint64_t* encoded;
+        if (job->encoded) {
+            encoded = encoded_row(job->encoded, i);
+        } else {
+            const unsigned char* sample = job->features + (size_t)i * job->feature_stride;
+            encoded = encode_features(encoder, sample, NULL);
+        }
+        
+        // Accumulate into the thread's private counters (no binarization yet)
+        add_encoded_vector(partial, job->labels[i], encoded);
+    }
+}
+
+// Reduce the private accumulators, each thread owning a slice of dimensions
+static void merge_shard_task(void* arg, int thread_id, int n_threads) {
+    TrainJob* job = (TrainJob*)arg;
+    ClassVectors* cv = job->context->class_vectors;
+    
+    int begin, end;
+    thread_pool_shard(cv->dimension, thread_id, n_threads, &begin, &end);
+    merge_class_accumulators(cv, job->partials, n_threads, begin, end);
+}
+
+// Set up a training run. Thread 0 works directly on the context; the others
+// get private copies that finish_train_job folds back in.
+static int init_train_job(HDContext* context, TrainJob* job) {
+    int n_threads = context->pool->n_threads;
+    
+    memset(job, 0, sizeof(TrainJob));
+    job->context = context;
+    job->partials = (ClassVectors**)calloc(n_threads, sizeof(ClassVectors*));
+    int ok = job->partials != NULL;
+    
+    if (ok) {
+        job->partials[0] = context->class_vectors;
+        for (int t = 1; t < n_threads && ok; t++) {
+            job->partials[t] = init_class_vectors(context->n_classes, context->dimension, NULL);
+            ok = job->partials[t] != NULL;
+        }
+    }
+    
+    if (!ok) {
+        printf("Failed to allocate per-thread class accumulators\n");
+    }
+    return ok;
+}
+
+// Encode and accumulate one batch of samples on all threads
+static void run_train_batch(TrainJob* job, const unsigned char* features, int feature_stride,
+                            const unsigned char* labels, int n_samples) {
+    job->features = features;
+    job->feature_stride = feature_stride;
+    job->labels = labels;
+    job->n_samples = n_samples;
+    thread_pool_run(job->context->pool, train_shard_task, job);
+}
+
+// Merge the per-thread accumulators, binarize and release the job
+static void finish_train_job(TrainJob* job) {
+    HDContext* context = job->context;
+    int n_threads = context->pool->n_threads;
+    
+    ClassVectors* cv = context->class_vectors;
+    
+    // Lock-free reduction: accumulators by dimension slice, counts serially
+    if (n_threads > 1) {
+        thread_pool_run(context->pool, merge_shard_task, job);
+        for (int t = 1; t < n_threads; t++) {
+            for (int c = 0; c < context->n_classes; c++) {
+                if (job->partials[t]->class_counts[c] > 0) {
+                    cv->class_counts[c] += job->partials[t]->class_counts[c];
+                    cv->dirty[c] = 1;
+                    cv->has_dirty = 1;
+                }
+            }
+        }
+    }
+    
+    // Majority vote once all samples are accumulated (classes without new
+    // samples keep their vectors)
+    finalize_class_vectors(cv);
+}
+
+static void free_train_job(TrainJob* job) {
+    int n_threads = job->context->pool->n_threads;
+    for (int t = 1; t < n_threads && job->partials; t++) {
+        free_class_vectors(job->partials[t]);
+    }
+    free(job->partials);
+    job->partials = NULL;
+}
+
 // Train the HD model using a training dataset
 int hd_train(HDContext* context, Dataset* train_data) {
     if (!context || !train_data) {
@@ -195,28 +720,316 @@ int hd_train(HDContext* context, Dataset* train_data) {
         return 0;
     }
     
-    printf("\nTraining with %d samples...\n", train_data->number_of_samples);
-    int progress_step = train_data->number_of_samples / 20;
+    printf("\nTraining with %d samples on %d thread(s)...\n", 
+           train_data->number_of_samples, context->pool->n_threads);
     
-    for (int i = 0; i < train_data->number_of_samples; i++) {
-        // Show progress
-        if (i % progress_step == 0) {
-            printf("Training progress: %.1f%% (%d/%d)\n", 
-                   (float)i * 100 / train_data->number_of_samples, 
-                   i, train_data->number_of_samples);
+    TrainJob job;
+    if (!init_train_job(context, &job)) {
+        free_train_job(&job);
+        return 0;
+    }
+    
+    // Cached encodings replace per-sample encoding in the workers
+    if (context->cache_encodings) {
+        job.encoded = acquire_encodings(context, train_data->feature_data, 
+                                        train_data->feature_stride, 
+                                        train_data->number_of_samples);
+    }
+    
+    job.show_progress = 1;
+    run_train_batch(&job, train_data->feature_data, train_data->feature_stride,
+                    train_data->labels, train_data->number_of_samples);
+    finish_train_job(&job);
+    free_train_job(&job);
+    
+    if (HD_DEBUG_PRINT) {
+        print_class_vector_stats(context->class_vectors);
+    }
+    
+    context->is_trained = 1;
+    printf("Training completed.\n");
+    return 1;
+}
+
+// Online learning: add one sample to a (possibly trained) model. Only the
+// accumulator and hypervector of the sample's class are updated, so the
+// cost per call is one encoding plus O(dimension), independent of how much
+// the model has seen. Not thread-safe with other calls on the same context.
+int hd_partial_fit(HDContext* context, const unsigned char* features, int label) {
+    if (!context || !features) {
+        printf("Invalid parameters for incremental training\n");
+        return 0;
+    }
+
+    if (!context->is_initialized) {
+        printf("HD context not properly initialized\n");
+        return 0;
+    }
+    
+    if (label < 0 || label >= context->n_classes) {
+        printf("Invalid class label %d for incremental training\n", label);
+        return 0;
+    }
+    
+    const uint64_t* encoded = encode_features(context->encoder, features, NULL);
+    learn_encoded_vector(context->class_vectors, label, encoded);
+    context->is_trained = 1;
+    return 1;
+}
+
+// Batch variant of hd_partial_fit: the samples are encoded on the thread
+// pool and only the classes that received samples are re-binarized.
+int hd_partial_fit_batch(HDContext* context, const unsigned char* features, int feature_stride,
+                         const unsigned char* labels, int n_samples) {
+    if (!context || !features || !labels || n_samples < 0) {
+        printf("Invalid parameters for incremental training\n");
+        return 0;
+    }
+
+    if (!context->is_initialized) {
+        printf("HD context not properly initialized\n");
+        return 0;
+    }
+    
+    if (feature_stride < context->feature_dimension) {
+        printf("Feature stride %d is smaller than the feature dimension %d\n", 
+               feature_stride, context->feature_dimension);
+        return 0;
+    }
+    
+    // Reject the whole batch before any class is updated
+    for (int i = 0; i < n_samples; i++) {
+        if (labels[i] >= context->n_classes) {
+            printf("Invalid class label %d at sample %d for incremental training\n", 
+                   labels[i], i);
+            return 0;
         }
+    }
+    
+    TrainJob job;
+    if (!init_train_job(context, &job)) {
+        free_train_job(&job);
+        return 0;
+    }
+    
+    run_train_batch(&job, features, feature_stride, labels, n_samples);
+    finish_train_job(&job);
+    free_train_job(&job);
+    
+    context->is_trained = 1;
+    return 1;
+}
+
+// Refine a trained model with perceptron-style epochs. Every training sample
+// is encoded once; each epoch then classifies the cached encodings and, for
+// each mistake, adds the sample to its true class and subtracts it from the
+// predicted one. Stops early once an epoch makes no mistakes.
+int hd_retrain(HDContext* context, Dataset* train_data, int epochs) {
+    if (!context || !train_data || epochs < 0) {
+        printf("Invalid parameters for retraining\n");
+        return 0;
+    }
+    
+    if (!context->is_trained) {
+        printf("Model not trained yet\n");
+        return 0;
+    }
+    
+    printf("\nRetraining for up to %d epoch(s) with %d samples...\n", 
+           epochs, train_data->number_of_samples);
+    
+    HDEncodedSet* encoded = acquire_encodings(context, train_data->feature_data, 
+                                              train_data->feature_stride, 
+                                              train_data->number_of_samples);
+    if (!encoded) {
+        return 0;
+    }
+    
+    ClassVectors* cv = context->class_vectors;
+    int n = train_data->number_of_samples;
+    finalize_class_vectors(cv);
+    
+    for (int epoch = 1; epoch <= epochs; epoch++) {
+        int mistakes = 0;
         
-        // Encode the current sample
-        BundledVector* bundle = NULL;
-        hd_encode_sample(context, train_data->features[i], &bundle);
+        for (int i = 0; i < n; i++) {
+            const uint64_t* sample = encoded_row(encoded, i);
+            int label = train_data->labels[i];
+            int predicted = classify_encoded_vector(sample, cv, NULL);
+            
+            if (predicted != label) {
+                correct_encoded_vector(cv, label, predicted, sample);
+                finalize_class_vectors(cv);
+                mistakes++;
+            }
+        }
         
-        if (bundle) {
-            // Accumulate the encoded sample into the class vectors
-            accumulate_training_vector(context->class_vectors, 
-                                      train_data->labels[i], 
-                                      bundle);
-            free_bundled_vector(bundle);
+        printf("Retraining epoch %d: %d/%d misclassified (%.2f%% training accuracy)\n",
+               epoch, mistakes, n, n > 0 ? (float)(n - mistakes) * 100 / n : 100.0f);
+        if (mistakes == 0) break;
+    }
+    
+    release_encodings(context, encoded);
+    printf("Retraining completed.\n");
+    return 1;
+}
+
+// Reader thread that fills stream batches in the background. It is started
+// once per hd_train_stream call and handed one batch at a time.
+typedef struct {
+    DatasetStream* stream;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t changed;      // Signalled on a new request, completion or shutdown
+    DatasetBatch* request;       // Batch being filled (NULL when idle)
+    int result;                  // Return value of read_dataset_batch for the last request
+    int done;                    // Set once the last request has completed
+    int shutdown;
+    int running;                 // 0 if the thread could not be started (reads run inline)
+} BatchReader;
+
+static void* batch_reader_main(void* arg) {
+    BatchReader* reader = (BatchReader*)arg;
+    
+    pthread_mutex_lock(&reader->lock);
+    for (;;) {
+        while (!reader->request && !reader->shutdown) {
+            pthread_cond_wait(&reader->changed, &reader->lock);
         }
+        if (!reader->request) break;
+        
+        DatasetBatch* batch = reader->request;
+        pthread_mutex_unlock(&reader->lock);
+        int result = read_dataset_batch(reader->stream, batch);
+        pthread_mutex_lock(&reader->lock);
+        
+        reader->result = result;
+        reader->request = NULL;
+        reader->done = 1;
+        pthread_cond_broadcast(&reader->changed);
+    }
+    pthread_mutex_unlock(&reader->lock);
+    return NULL;
+}
+
+static void start_batch_reader(BatchReader* reader, DatasetStream* stream) {
+    memset(reader, 0, sizeof(BatchReader));
+    reader->stream = stream;
+    pthread_mutex_init(&reader->lock, NULL);
+    pthread_cond_init(&reader->changed, NULL);
+    reader->running = pthread_create(&reader->thread, NULL, batch_reader_main, reader) == 0;
+}
+
+// Start filling 'batch'; collect the result with wait_batch
+static void request_batch(BatchReader* reader, DatasetBatch* batch) {
+    if (!reader->running) {
+        reader->result = read_dataset_batch(reader->stream, batch);
+        return;
+    }
+    
+    pthread_mutex_lock(&reader->lock);
+    reader->request = batch;
+    reader->done = 0;
+    pthread_cond_broadcast(&reader->changed);
+    pthread_mutex_unlock(&reader->lock);
+}
+
+static int wait_batch(BatchReader* reader) {
+    if (reader->running) {
+        pthread_mutex_lock(&reader->lock);
+        while (!reader->done) {
+            pthread_cond_wait(&reader->changed, &reader->lock);
+        }
+        pthread_mutex_unlock(&reader->lock);
+    }
+    return reader->result;
+}
+
+// Call when no request is pending
+static void stop_batch_reader(BatchReader* reader) {
+    if (reader->running) {
+        pthread_mutex_lock(&reader->lock);
+        reader->shutdown = 1;
+        pthread_cond_broadcast(&reader->changed);
+        pthread_mutex_unlock(&reader->lock);
+        pthread_join(reader->thread, NULL);
+    }
+    pthread_cond_destroy(&reader->changed);
+    pthread_mutex_destroy(&reader->lock);
+}
+
+// Train from a stream without loading the dataset. Two batch buffers are
+// used in turn: while the pool encodes one, a reader thread (started once)
+// fills the other, so at most two batches of features are in memory at once.
+int hd_train_stream(HDContext* context, DatasetStream* stream, int batch_size) {
+    if (!context || !stream) {
+        printf("Invalid parameters for training\n");
+        return 0;
+    }
+
+    if (!context->is_initialized) {
+        printf("HD context not properly initialized\n");
+        return 0;
+    }
+    
+    if (stream->feature_dimension != context->feature_dimension) {
+        printf("Stream has %d features, model expects %d\n", 
+               stream->feature_dimension, context->feature_dimension);
+        return 0;
+    }
+    
+    if (batch_size <= 0) {
+        batch_size = HD_STREAM_BATCH;
+    }
+    
+    printf("\nStreaming training from %s in batches of %d on %d thread(s)...\n", 
+           stream->name, batch_size, context->pool->n_threads);
+    
+    DatasetBatch batches[2];
+    memset(batches, 0, sizeof(batches));
+    TrainJob job;
+    int ok = init_train_job(context, &job) &&
+             alloc_dataset_batch(&batches[0], batch_size, stream->feature_dimension) &&
+             alloc_dataset_batch(&batches[1], batch_size, stream->feature_dimension);
+    if (!ok) {
+        free_dataset_batch(&batches[0]);
+        free_dataset_batch(&batches[1]);
+        free_train_job(&job);
+        return 0;
+    }
+    
+    BatchReader reader;
+    start_batch_reader(&reader, stream);
+    
+    long long total = 0;
+    int current = 0;
+    request_batch(&reader, &batches[current]);
+    int n = wait_batch(&reader);
+    
+    while (n > 0) {
+        // Start reading the next batch, then encode this one meanwhile
+        request_batch(&reader, &batches[1 - current]);
+        
+        DatasetBatch* batch = &batches[current];
+        run_train_batch(&job, batch->feature_data, batch->feature_stride, batch->labels, n);
+        
+        total += n;
+        printf("Training progress: %lld samples\n", total);
+        
+        n = wait_batch(&reader);
+        current = 1 - current;
+    }
+    stop_batch_reader(&reader);
+    
+    // Keep what was accumulated even if the stream failed part-way
+    finish_train_job(&job);
+    free_train_job(&job);
+    free_dataset_batch(&batches[0]);
+    free_dataset_batch(&batches[1]);
+    
+    if (n < 0) {
+        printf("Error reading training stream after %lld samples\n", total);
+        return 0;
     }
     
     if (HD_DEBUG_PRINT) {
@@ -224,7 +1037,7 @@ int hd_train(HDContext* context, Dataset* train_data) {
     }
     
     context->is_trained = 1;
-    printf("Training completed.\n");
+    printf("Training completed (%lld samples).\n", total);
     return 1;
 }
 
@@ -261,19 +1074,8 @@ int hd_save_model(HDContext* context, const char* filename) {
     fprintf(fp, "#define NUM_CLASSES %d\n", context->n_classes);
     fprintf(fp, "#define DATASET_NAME \"%s\"\n\n", context->dataset_name);
     
-    // Helper macro to pack a vector
-    #define PACK_AND_WRITE(vector, packed, dim) do { \
-        memset(packed, 0, packed_dim); \
-        for (int bit = 0; bit < dim; bit++) { \
-            if (vector[bit]) { \
-                packed[bit / 8] |= (1 << (bit % 8)); \
-            } \
-        } \
-    } while(0)
-    
-    // Write item memory
-    fprintf(fp, "const uint8_t packed_item_memory[%d][%d] = {\n", 
-            context->feature_dimension, packed_dim);
+    // Helper macro to pack a vector (bit i -> byte i/8, bit i%8)
+    #define PACK_AND_WRITE(vector, packed, dim) hypervector_to_bytes(vector, packed, dim)
     
     uint8_t* packed = (uint8_t*)malloc(packed_dim);
     if (!packed) {
@@ -282,23 +1084,36 @@ int hd_save_model(HDContext* context, const char* filename) {
         return 0;
     }
     
-    for (int i = 0; i < context->feature_dimension; i++) {
-        PACK_AND_WRITE(context->item_memory[i], packed, context->dimension);
+    // Write item memory. Procedural item vectors are not stored: word w of
+    // item i is hd_item_word(ITEM_SEED, i, w) from hd_random.h. In permutation
+    // mode feature i binds to its level vector rotated by i bits.
+    if (context->item_mode == HD_ITEM_TABLE) {
+        fprintf(fp, "const uint8_t packed_item_memory[%d][%d] = {\n", 
+                context->feature_dimension, packed_dim);
         
-        fprintf(fp, "    {");
-        for (int j = 0; j < packed_dim; j++) {
-            fprintf(fp, "0x%02X%s", packed[j], j < packed_dim - 1 ? "," : "");
+        for (int i = 0; i < context->feature_dimension; i++) {
+            PACK_AND_WRITE(hd_row(context->item_memory, HD_ROW_WORDS(context->dimension), i), 
+                           packed, context->dimension);
+            
+            fprintf(fp, "    {");
+            for (int j = 0; j < packed_dim; j++) {
+                fprintf(fp, "0x%02X%s", packed[j], j < packed_dim - 1 ? "," : "");
+            }
+            fprintf(fp, "}%s\n", i < context->feature_dimension - 1 ? "," : "");
         }
-        fprintf(fp, "}%s\n", i < context->feature_dimension - 1 ? "," : "");
+        fprintf(fp, "};\n\n");
+    } else if (context->item_mode == HD_ITEM_PROCEDURAL) {
+        fprintf(fp, "#define ITEM_SEED 0x%016llXULL\n\n", (unsigned long long)context->seed);
+    } else {
+        fprintf(fp, "#define ITEM_PERMUTATION 1\n\n");
     }
-    fprintf(fp, "};\n\n");
     
     // Write level vectors
     fprintf(fp, "const uint8_t packed_level_vectors[%d][%d] = {\n", 
             context->levels, packed_dim);
     
     for (int i = 0; i < context->levels; i++) {
-        PACK_AND_WRITE(context->level_vectors->vectors[i], packed, context->dimension);
+        PACK_AND_WRITE(level_vector(context->level_vectors, i), packed, context->dimension);
         
         fprintf(fp, "    {");
         for (int j = 0; j < packed_dim; j++) {
@@ -313,7 +1128,7 @@ int hd_save_model(HDContext* context, const char* filename) {
             context->n_classes, packed_dim);
     
     for (int i = 0; i < context->n_classes; i++) {
-        PACK_AND_WRITE(context->class_vectors->class_hvs[i], packed, context->dimension);
+        PACK_AND_WRITE(class_hv(context->class_vectors, i), packed, context->dimension);
         
         fprintf(fp, "    {");
         for (int j = 0; j < packed_dim; j++) {
@@ -330,15 +1145,288 @@ int hd_save_model(HDContext* context, const char* filename) {
     printf("Generated packed vectors header file: %s\n", filename);
     printf("Packed dimension: %d bytes\n", packed_dim);
     printf("Total memory usage:\n");
-    printf("- Item Memory: %d bytes\n", context->feature_dimension * packed_dim);
+    
+    // Only the table mode stores item vectors; procedural mode keeps the seed
+    int item_bytes = 0;
+    if (context->item_mode == HD_ITEM_TABLE) {
+        item_bytes = context->feature_dimension * packed_dim;
+        printf("- Item Memory: %d bytes\n", item_bytes);
+    } else if (context->item_mode == HD_ITEM_PROCEDURAL) {
+        item_bytes = (int)sizeof(uint64_t);
+        printf("- Item Memory: %d bytes (seed only)\n", item_bytes);
+    } else {
+        printf("- Item Memory: 0 bytes (rotation)\n");
+    }
     printf("- Level Vectors: %d bytes\n", context->levels * packed_dim);
     printf("- Class HVs: %d bytes\n", context->n_classes * packed_dim);
     printf("Total: %d bytes\n", 
-           (context->feature_dimension + context->levels + context->n_classes) * packed_dim);
+           item_bytes + (context->levels + context->n_classes) * packed_dim);
     
     return 1;
 }
 
+// Save the model in the binary format of hd_model.h
+int hd_save_model_binary(HDContext* context, const char* filename) {
+    if (!context || !filename) {
+        printf("Invalid parameters for model saving\n");
+        return 0;
+    }
+    
+    if (!context->is_trained) {
+        printf("Model not trained yet\n");
+        return 0;
+    }
+    
+    ClassVectors* cv = context->class_vectors;
+    finalize_class_vectors(cv);
+    
+    HDModelHeader header;
+    hd_model_layout(&header, context->dimension, context->levels, context->feature_dimension,
+                    context->n_classes, cv->acc_stride, context->item_mode);
+    header.randomness = context->randomness;
+    header.seed = context->seed;
+    memcpy(header.dataset_name, context->dataset_name, sizeof(header.dataset_name) - 1);
+    
+    // Assemble the payload exactly as it will be mapped (padding stays zero)
+    size_t payload_size = header.file_size - header.header_size;
+    unsigned char* payload = (unsigned char*)calloc(1, payload_size);
+    if (!payload) {
+        printf("Failed to allocate model buffer\n");
+        return 0;
+    }
+    
+    size_t row_bytes = (size_t)header.row_words * sizeof(uint64_t);
+    memcpy(payload + header.level_offset - header.header_size, context->level_vectors->vectors,
+           (size_t)context->levels * row_bytes);
+    if (context->item_mode == HD_ITEM_TABLE) {
+        memcpy(payload + header.item_offset - header.header_size, context->item_memory,
+               (size_t)context->feature_dimension * row_bytes);
+    }
+    memcpy(payload + header.class_offset - header.header_size, cv->class_hvs,
+           (size_t)context->n_classes * row_bytes);
+    memcpy(payload + header.accumulator_offset - header.header_size, cv->accumulators,
+           (size_t)context->n_classes * cv->acc_stride * sizeof(int));
+    memcpy(payload + header.count_offset - header.header_size, cv->class_counts,
+           (size_t)context->n_classes * sizeof(int));
+    header.checksum = hd_model_checksum(payload, payload_size);
+    
+    FILE* fp = fopen(filename, "wb");
+    if (!fp) {
+        printf("Error opening file for writing: %s\n", filename);
+        free(payload);
+        return 0;
+    }
+    
+    int ok = fwrite(&header, sizeof(header), 1, fp) == 1 &&
+             fwrite(payload, 1, payload_size, fp) == payload_size;
+    ok = (fclose(fp) == 0) && ok;
+    free(payload);
+    
+    if (!ok) {
+        printf("Error writing model file: %s\n", filename);
+        return 0;
+    }
+    
+    printf("Saved binary model: %s (%llu bytes)\n", filename, 
+           (unsigned long long)header.file_size);
+    return 1;
+}
+
+// Map a binary model file and build a ready-to-use context on top of it.
+// The tables are used in place; the private mapping lets further training
+// modify them without writing back to the file.
+HDContext* hd_load_model(const char* filename) {
+    if (!filename) {
+        printf("Invalid parameters for model loading\n");
+        return NULL;
+    }
+    
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        printf("Error opening model file: %s\n", filename);
+        return NULL;
+    }
+    
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(HDModelHeader)) {
+        printf("Invalid model file: %s\n", filename);
+        close(fd);
+        return NULL;
+    }
+    
+    size_t file_size = (size_t)st.st_size;
+    unsigned char* base = (unsigned char*)mmap(NULL, file_size, PROT_READ | PROT_WRITE, 
+                                               MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        printf("Failed to map model file: %s\n", filename);
+        return NULL;
+    }
+    
+    const HDModelHeader* header = (const HDModelHeader*)base;
+    if (!hd_model_validate(header, file_size) ||
+        hd_model_checksum(base + header->header_size, file_size - header->header_size) != 
+            header->checksum) {
+        printf("Model file failed integrity check: %s\n", filename);
+        munmap(base, file_size);
+        return NULL;
+    }
+    
+    HDContext* context = (HDContext*)calloc(1, sizeof(HDContext));
+    if (!context) {
+        printf("Failed to allocate HD context\n");
+        munmap(base, file_size);
+        return NULL;
+    }
+    
+    context->mapped_model = base;
+    context->mapped_size = file_size;
+    context->dimension = header->dimension;
+    context->levels = header->levels;
+    context->randomness = header->randomness;
+    context->seed = header->seed;
+    context->feature_dimension = header->feature_dimension;
+    context->n_classes = header->n_classes;
+    memcpy(context->dataset_name, header->dataset_name, sizeof(context->dataset_name) - 1);
+    
+    hd_popcount_init();
+    printf("Hamming distance kernel: %s\n", 
+           hd_popcount_backend_name(hd_popcount_get_backend()));
+    
+    // Point the context at the mapped sections
+    context->item_mode = (HDItemMode)header->item_mode;
+    context->item_memory = context->item_mode == HD_ITEM_TABLE ? 
+                           (uint64_t*)(base + header->item_offset) : NULL;
+    context->level_vectors = wrap_level_vectors(context->levels, context->dimension, 
+                                                context->randomness,
+                                                (uint64_t*)(base + header->level_offset));
+    context->class_vectors = wrap_class_vectors(context->n_classes, context->dimension,
+                                                header->acc_stride,
+                                                (int*)(base + header->count_offset),
+                                                (int*)(base + header->accumulator_offset),
+                                                (uint64_t*)(base + header->class_offset));
+    context->mapping = init_mapping(0, 255, context->levels);
+    if (!context->level_vectors || !context->class_vectors || !context->mapping) {
+        printf("Failed to set up model tables\n");
+        hd_free(context);
+        return NULL;
+    }
+    attach_level_vectors(context->mapping, context->level_vectors);
+    init_bound_table(context);
+    
+    context->encoder = new_context_encoder(context);
+    if (!context->encoder || !start_workers(context, hd_default_thread_count())) {
+        printf("Failed to initialize encoder workspace\n");
+        hd_free(context);
+        return NULL;
+    }
+    
+    hd_set_encoding_cache(context, HD_ENCODING_CACHE, HD_ENCODING_SPILL_DIR);
+    context->is_initialized = 1;
+    context->is_trained = 1;
+    printf("Loaded %s model from %s\n", context->dataset_name, filename);
+    return context;
+}
+
+// Shared state for one batch prediction run
+typedef struct {
+    HDContext* context;
+    const unsigned char* features;  // Row-major, feature_stride bytes per sample
+    int feature_stride;
+    const unsigned char* labels;  // Optional, enables the confusion counters
+    const HDEncodedSet* encoded;  // Cached encodings (NULL = encode here)
+    int* predictions;
+    int* confusion;               // n_threads blocks of confusion_stride ints
+    int confusion_stride;
+} PredictJob;
+
+static void predict_range(void* arg, int begin, int end, int thread_id) {
+    PredictJob* job = (PredictJob*)arg;
+    HDEncoder* encoder = job->context->thread_encoders[thread_id];
+    const ClassVectors* cv = job->context->class_vectors;
+    int n_classes = cv->n_classes;
+    int* confusion = job->confusion ? job->confusion + thread_id * job->confusion_stride : NULL;
+    
+    for (int i = begin; i < end; i++) {
+        const uint64_t* encoded;
+        if (job->encoded) {
+            encoded = encoded_row(job->encoded, i);
+        } else {
+            const unsigned char* sample = job->features + (size_t)i * job->feature_stride;
+            encoded = encode_features(encoder, sample, NULL);
+        }
+        int predicted_class = classify_encoded_vector(encoded, cv, NULL);
+        job->predictions[i] = predicted_class;
+        
+        if (confusion && job->labels[i] < n_classes && predicted_class >= 0) {
+            confusion[job->labels[i] * n_classes + predicted_class]++;
+        }
+    }
+}
+
+// Predict n_samples on the thread pool. If labels and confusion are given,
+// confusion (n_classes x n_classes, rows = true label) receives the counts.
+static int run_batch(HDContext* context, const unsigned char* features, int feature_stride,
+                     const unsigned char* labels, int n_samples, 
+                     int* predictions, int* confusion) {
+    int n_threads = context->pool->n_threads;
+    int n_classes = context->n_classes;
+    
+    // Refresh stale class vectors before the workers start reading them
+    finalize_class_vectors(context->class_vectors);
+
+    PredictJob job;
+    job.context = context;
+    job.features = features;
+    job.feature_stride = feature_stride;
+    job.labels = labels;
+    job.encoded = context->cache_encodings ? 
+                  acquire_encodings(context, features, feature_stride, n_samples) : NULL;
+    job.predictions = predictions;
+    job.confusion = NULL;
+    // Pad each thread's matrix to whole cache lines to avoid false sharing
+    job.confusion_stride = (n_classes * n_classes + 15) / 16 * 16;
+    
+    if (labels && confusion) {
+        job.confusion = (int*)calloc(n_threads * job.confusion_stride, sizeof(int));
+        if (!job.confusion) {
+            printf("Failed to allocate per-thread confusion counters\n");
+            return 0;
+        }
+    }
+    
+    int ok = thread_pool_for(context->pool, n_samples, HD_BATCH_CHUNK, predict_range, &job);
+    
+    // Merge the per-thread counters
+    if (ok && job.confusion) {
+        for (int t = 0; t < n_threads; t++) {
+            for (int k = 0; k < n_classes * n_classes; k++) {
+                confusion[k] += job.confusion[t * job.confusion_stride + k];
+            }
+        }
+    }
+    
+    free(job.confusion);
+    return ok;
+}
+
+// Predict a batch of samples in parallel, writing one class per sample.
+// Sample i starts at features + i * feature_stride.
+int hd_predict_batch(HDContext* context, const unsigned char* features, int feature_stride,
+                     int n_samples, int* predictions) {
+    if (!context || !features || !predictions || n_samples < 0) {
+        printf("Invalid parameters for batch prediction\n");
+        return 0;
+    }
+    
+    if (!context->is_trained) {
+        printf("Model not trained yet\n");
+        return 0;
+    }
+    
+    return run_batch(context, features, feature_stride, NULL, n_samples, predictions, NULL);
+}
+
 // Predict the class of a single sample
 int hd_predict(HDContext* context, unsigned char* features, int* prediction) {
     if (!context || !features || !prediction) {
@@ -354,25 +1442,12 @@ int hd_predict(HDContext* context, unsigned char* features, int* prediction) {
     // Initialize prediction to -1 (invalid)
     *prediction = -1;
     
-    // Encode the features
-    BundledVector* encoded = NULL;
-    hd_encode_sample(context, features, &encoded);
-    if (!encoded) {
-        printf("Failed to encode sample for prediction\n");
-        return 0;
-    }
+    // Encode the features into the encoder workspace
+    const uint64_t* encoded = encode_features(context->encoder, features, NULL);
     
     // Compute similarity and get prediction
-    InferenceResult* result = compute_similarity(encoded, context->class_vectors);
-    if (!result) {
-        printf("Failed to compute similarity for prediction\n");
-        free_bundled_vector(encoded);
-        return 0;
-    }
-    
-    *prediction = result->predicted_class;
-    free_inference_result(result);
-    free_bundled_vector(encoded);
+    finalize_class_vectors(context->class_vectors);
+    *prediction = classify_encoded_vector(encoded, context->class_vectors, NULL);
     
     return 1;
 }
@@ -389,8 +1464,18 @@ float hd_evaluate(HDContext* context, Dataset* test_data) {
         return 0.0f;
     }
     
-    int correct = 0;
-    int total = 0;
+    int n_classes = context->n_classes;
+    int n_samples = test_data->number_of_samples;
+    int* predictions = (int*)malloc(n_samples * sizeof(int));
+    int* confusion = (int*)calloc(n_classes * n_classes, sizeof(int));
+    int* distances = (int*)malloc(n_classes * sizeof(int));
+    if (!predictions || !confusion || !distances) {
+        printf("Failed to allocate evaluation buffers\n");
+        free(predictions);
+        free(confusion);
+        free(distances);
+        return 0.0f;
+    }
     
     printf("\nEvaluating model on %d test samples...\n", test_data->number_of_samples);
     
@@ -414,7 +1499,7 @@ float hd_evaluate(HDContext* context, Dataset* test_data) {
             fprintf(test_fp, "    {");
             for (int j = 0; j < test_data->feature_dimension; j++) {
                 fprintf(test_fp, "%d%s", 
-                        test_data->features[i][j],
+                        dataset_sample(test_data, i)[j],
                         (j < test_data->feature_dimension - 1) ? ", " : "");
             }
             fprintf(test_fp, "}%s\n", (i < num_samples - 1) ? "," : "");
@@ -442,64 +1527,80 @@ float hd_evaluate(HDContext* context, Dataset* test_data) {
     }
     #endif
     
-    for (int i = 0; i < test_data->number_of_samples; i++) {
-        if (i % 100 == 0) {
-            printf("Processing test sample %d/%d\n", i, test_data->number_of_samples);
-        }
-        
-        // Encode the features
-        BundledVector* encoded = NULL;
-        hd_encode_sample(context, test_data->features[i], &encoded);
-        if (!encoded) {
-            printf("Failed to encode test sample %d\n", i);
-            continue;
-        }
-        
-        // Compute similarity and get prediction
-        InferenceResult* result = compute_similarity(encoded, context->class_vectors);
-        if (!result) {
-            printf("Failed to compute similarity for test sample %d\n", i);
-            free_bundled_vector(encoded);
-            continue;
-        }
-        
+    // Predict all samples on the thread pool, counting into per-thread matrices
+    if (!run_batch(context, test_data->feature_data, test_data->feature_stride, 
+                   test_data->labels, n_samples, predictions, confusion)) {
+        printf("Batch evaluation failed\n");
+        free(predictions);
+        free(confusion);
+        free(distances);
+        return 0.0f;
+    }
+    
+    // Display detailed information for the first 5 samples
+    for (int i = 0; i < n_samples && i < 5; i++) {
+        const uint64_t* encoded = encode_features(context->encoder, 
+                                                  dataset_sample(test_data, i), NULL);
+        int predicted_class = classify_encoded_vector(encoded, context->class_vectors, 
+                                                      distances);
         int true_label = test_data->labels[i];
-        int predicted_class = result->predicted_class;
         
-        // Update statistics
-        total++;
-        if (predicted_class == true_label) {
-            correct++;
-        }
+        printf("\nTest sample %d:\n", i);
+        printf("True label: %d, Predicted: %d\n", true_label, predicted_class);
+        printf("Hamming distances (lower is better):\n");
         
-        // Display detailed information for the first 5 samples
-        if (i < 5) {
-            printf("\nTest sample %d:\n", i);
-            printf("True label: %d, Predicted: %d\n", true_label, predicted_class);
-            printf("Hamming distances (lower is better):\n");
+        for (int c = 0; c < n_classes; c++) {
+            printf("Class %d: %d ", c, distances[c]);
             
-            for (int c = 0; c < context->n_classes; c++) {
-                printf("Class %d: %d ", c, result->similarities[c]);
-                
-                // Mark the minimum distance (best match)
-                if (c == predicted_class) {
-                    printf("(BEST)");
-                }
-                
-                // Mark the true label
-                if (c == true_label) {
-                    printf("(TRUE)");
-                }
-                
-                printf("\n");
+            // Mark the minimum distance (best match)
+            if (c == predicted_class) {
+                printf("(BEST)");
             }
+            
+            // Mark the true label
+            if (c == true_label) {
+                printf("(TRUE)");
+            }
+            
+            printf("\n");
         }
-        
-        free_inference_result(result);
-        free_bundled_vector(encoded);
     }
     
-    float accuracy = (float)correct / total * 100.0f;
+    // Accuracy and per-class statistics from the confusion matrix
+    int correct = 0;
+    int total = 0;
+    for (int t = 0; t < n_classes; t++) {
+        for (int p = 0; p < n_classes; p++) {
+            total += confusion[t * n_classes + p];
+        }
+        correct += confusion[t * n_classes + t];
+    }
+    
+    printf("\nPer-class Accuracy:\n");
+    for (int t = 0; t < n_classes; t++) {
+        int class_total = 0;
+        for (int p = 0; p < n_classes; p++) {
+            class_total += confusion[t * n_classes + p];
+        }
+        int class_correct = confusion[t * n_classes + t];
+        printf("Class %d: %.2f%% (%d/%d)\n", t, 
+               class_total > 0 ? (float)class_correct / class_total * 100.0f : 0.0f,
+               class_correct, class_total);
+    }
+    
+    printf("\nConfusion matrix (rows: true, columns: predicted):\n");
+    for (int t = 0; t < n_classes; t++) {
+        for (int p = 0; p < n_classes; p++) {
+            printf("%6d", confusion[t * n_classes + p]);
+        }
+        printf("\n");
+    }
+    
+    free(predictions);
+    free(confusion);
+    free(distances);
+    
+    float accuracy = total > 0 ? (float)correct / total * 100.0f : 0.0f;
     printf("\nOverall Accuracy: %.2f%% (%d/%d)\n", accuracy, correct, total);
     
     return accuracy;
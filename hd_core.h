@@ -4,6 +4,8 @@
 
 #include "config.h"
 #include "dataset.h"
+#include "hd_vector.h"
+#include "hd_arena.h"
 #include "hd_level.h"
 #include "hd_mapping.h"
 #include "hd_binding.h"
@@ -11,19 +13,31 @@
 #include "hd_training.h"
 #include "hd_inference.h"
 #include "hd_similarity.h"
+#include "hd_encoder.h"
+#include "hd_parallel.h"
+#include "hd_encoded.h"
 
 // The main HD Computing context structure
 typedef struct {
     // Core HD components
+    HDArena* arena;              // Owns the level, item and class vector tables
     HDLevelVectors* level_vectors;
     HDMapping* mapping;
-    char** item_memory;
+    uint64_t* item_memory;       // feature_dimension rows, HD_ROW_WORDS(dimension) apart
+                                 // (NULL unless item_mode is HD_ITEM_TABLE)
     ClassVectors* class_vectors;
+    uint64_t* bound_table;       // Level XOR item rows per (feature, level), or NULL
+    HDEncoder* encoder;          // Reusable workspace for serial encoding
+    HDThreadPool* pool;          // Worker threads for training and batch inference
+    HDEncoder** thread_encoders; // One encoder per pool thread ([0] is encoder)
     
     // Configuration
     int dimension;
     int levels;
     float randomness;
+    uint64_t seed;           // Level and item tables are generated from this
+    HDItemMode item_mode;    // Stored or procedural item vectors
+    int num_threads;         // Threads used by hd_train / hd_predict_batch
   
     int feature_dimension;   // Renamed from image_size for generality
     int n_classes;
@@ -34,21 +48,68 @@ typedef struct {
     
     // Dataset information
     char dataset_name[64];
+    
+    // Set when the tables live in a mapped model file (see hd_load_model)
+    void* mapped_model;
+    size_t mapped_size;
+    
+    // Encoded-sample cache (see hd_set_encoding_cache)
+    int cache_encodings;
+    char spill_dir[192];        // Spill files go here ("" = keep in RAM)
+    HDEncodedSet* encoded_cache[HD_ENCODED_CACHE_SLOTS];
+    int encoded_cache_next;     // Slot reused next
 } HDContext;
 
 // Initialization and cleanup
 HDContext* hd_init(int dimension, int levels, float randomness, 
                   int feature_dimension, int n_classes, const char* dataset_name);
+HDContext* hd_init_with_seed(int dimension, int levels, float randomness, 
+                             int feature_dimension, int n_classes, const char* dataset_name,
+                             uint64_t seed);
+HDContext* hd_init_with_items(int dimension, int levels, float randomness, 
+                              int feature_dimension, int n_classes, const char* dataset_name,
+                              uint64_t seed, HDItemMode item_mode);
 void hd_free(HDContext* context);
+int hd_set_num_threads(HDContext* context, int n_threads);
+
+// Keep encoded samples between hd_train, hd_retrain, hd_evaluate and
+// hd_predict_batch calls, keyed by model tables and sample content, so the
+// same data is only encoded once. spill_dir (NULL or "" = RAM) holds
+// mmapped spill files that are also reused by later runs.
+int hd_set_encoding_cache(HDContext* context, int enabled, const char* spill_dir);
+void hd_clear_encoding_cache(HDContext* context);
 
 // Training functions
 int hd_train(HDContext* context, Dataset* train_data);
 int hd_save_model(HDContext* context, const char* filename);
 
+// Out-of-core training: consumes the stream batch by batch (batch_size <= 0
+// uses HD_STREAM_BATCH) while the next batch is read in the background
+int hd_train_stream(HDContext* context, DatasetStream* stream, int batch_size);
+
+// Incremental learning on an existing model: updates the accumulators in
+// place and re-binarizes only the classes that received samples
+int hd_partial_fit(HDContext* context, const unsigned char* features, int label);
+int hd_partial_fit_batch(HDContext* context, const unsigned char* features, int feature_stride,
+                         const unsigned char* labels, int n_samples);
+
+// Perceptron-style refinement epochs over the training set (see hd_core.c)
+int hd_retrain(HDContext* context, Dataset* train_data, int epochs);
+
+// Binary model files (format in hd_model.h). hd_load_model maps the file and
+// uses its tables in place, so no retraining is needed at startup.
+int hd_save_model_binary(HDContext* context, const char* filename);
+HDContext* hd_load_model(const char* filename);
+
 // Inference functions
 int hd_predict(HDContext* context, unsigned char* features, int* prediction);
+int hd_predict_batch(HDContext* context, const unsigned char* features, int feature_stride,
+                     int n_samples, int* predictions);
 float hd_evaluate(HDContext* context, Dataset* test_data);
 
+// Encode a sample into caller-provided storage (HD_WORDS(dimension) words)
+int hd_encode_into(HDContext* context, const unsigned char* features, uint64_t* result);
+
 // Internal utility functions (not to be used directly by client code)
 void hd_encode_sample(HDContext* context, unsigned char* features, BundledVector** result);
 
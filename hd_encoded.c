@@ -0,0 +1,177 @@
+// hd_encoded.c - Sets of encoded samples, kept in RAM or in mmapped spill files
+#include "hd_encoded.h"
+#include "hd_arena.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*
+ * A spill file is a 64-byte header followed by the rows exactly as they are
+ * used in memory, so an existing file is mapped and used without copying.
+ * The file is only valid for the key, check hash and shape it was written with.
+ */
+
+#define HD_ENCODED_MAGIC "HDENC\0\0\0"
+#define HD_ENCODED_MAGIC_SIZE 8
+#define HD_ENCODED_VERSION 2
+
+typedef struct {
+    char magic[HD_ENCODED_MAGIC_SIZE];
+    uint32_t version;
+    uint32_t header_size;
+    uint64_t key;
+    uint64_t check;
+    int32_t n_samples;
+    int32_t dimension;
+    int32_t stride;
+    unsigned char reserved[20];
+} HDEncodedHeader;
+
+_Static_assert(sizeof(HDEncodedHeader) == HD_ALIGNMENT, "rows must stay aligned");
+
+static size_t encoded_rows_bytes(int n_samples, int dimension) {
+    return arena_footprint((size_t)n_samples * HD_ROW_WORDS(dimension) * sizeof(uint64_t));
+}
+
+static HDEncodedSet* new_encoded_set(uint64_t key, uint64_t check, int n_samples, int dimension) {
+    HDEncodedSet* set = (HDEncodedSet*)calloc(1, sizeof(HDEncodedSet));
+    if (!set) {
+        printf("Failed to allocate encoded sample set\n");
+        return NULL;
+    }
+
+    set->key = key;
+    set->check = check;
+    set->n_samples = n_samples;
+    set->dimension = dimension;
+    set->stride = HD_ROW_WORDS(dimension);
+    return set;
+}
+
+HDEncodedSet* init_encoded_set(uint64_t key, uint64_t check, int n_samples, int dimension) {
+    HDEncodedSet* set = new_encoded_set(key, check, n_samples, dimension);
+    if (!set) return NULL;
+
+    size_t bytes = encoded_rows_bytes(n_samples, dimension);
+    set->vectors = (uint64_t*)aligned_alloc(HD_ALIGNMENT, bytes > 0 ? bytes : HD_ALIGNMENT);
+    if (!set->vectors) {
+        printf("Failed to allocate memory for %d encoded samples\n", n_samples);
+        free(set);
+        return NULL;
+    }
+    return set;
+}
+
+HDEncodedSet* create_encoded_spill(const char* path, uint64_t key, uint64_t check, 
+                                   int n_samples, int dimension) {
+    HDEncodedSet* set = new_encoded_set(key, check, n_samples, dimension);
+    if (!set) return NULL;
+
+    snprintf(set->path, sizeof(set->path), "%s", path);
+    char temp_path[sizeof(set->path) + 8];
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", path);
+
+    size_t size = sizeof(HDEncodedHeader) + encoded_rows_bytes(n_samples, dimension);
+    int fd = open(temp_path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0 || ftruncate(fd, (off_t)size) != 0) {
+        printf("Error creating spill file: %s\n", temp_path);
+        if (fd >= 0) close(fd);
+        free(set);
+        return NULL;
+    }
+
+    // Shared mapping: the rows are written straight to the file
+    void* base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        printf("Error mapping spill file: %s\n", temp_path);
+        unlink(temp_path);
+        free(set);
+        return NULL;
+    }
+
+    set->mapped = base;
+    set->mapped_size = size;
+    set->vectors = (uint64_t*)((unsigned char*)base + sizeof(HDEncodedHeader));
+    return set;
+}
+
+int commit_encoded_spill(HDEncodedSet* set) {
+    HDEncodedHeader* header = (HDEncodedHeader*)set->mapped;
+    memset(header, 0, sizeof(HDEncodedHeader));
+    memcpy(header->magic, HD_ENCODED_MAGIC, HD_ENCODED_MAGIC_SIZE);
+    header->version = HD_ENCODED_VERSION;
+    header->header_size = sizeof(HDEncodedHeader);
+    header->key = set->key;
+    header->check = set->check;
+    header->n_samples = set->n_samples;
+    header->dimension = set->dimension;
+    header->stride = set->stride;
+
+    char temp_path[sizeof(set->path) + 8];
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", set->path);
+    if (msync(set->mapped, set->mapped_size, MS_SYNC) != 0 || rename(temp_path, set->path) != 0) {
+        printf("Error writing spill file: %s\n", set->path);
+        unlink(temp_path);
+        return 0;
+    }
+    return 1;
+}
+
+HDEncodedSet* open_encoded_spill(const char* path, uint64_t key, uint64_t check, 
+                                 int n_samples, int dimension) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    struct stat st;
+    size_t size = sizeof(HDEncodedHeader) + encoded_rows_bytes(n_samples, dimension);
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size != size) {
+        close(fd);
+        return NULL;
+    }
+
+    void* base = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return NULL;
+    }
+
+    const HDEncodedHeader* header = (const HDEncodedHeader*)base;
+    if (memcmp(header->magic, HD_ENCODED_MAGIC, HD_ENCODED_MAGIC_SIZE) != 0 ||
+        header->version != HD_ENCODED_VERSION || header->key != key ||
+        header->check != check ||
+        header->n_samples != n_samples || header->dimension != dimension ||
+        header->stride != HD_ROW_WORDS(dimension)) {
+        munmap(base, size);
+        return NULL;
+    }
+
+    HDEncodedSet* set = new_encoded_set(key, check, n_samples, dimension);
+    if (!set) {
+        munmap(base, size);
+        return NULL;
+    }
+
+    snprintf(set->path, sizeof(set->path), "%s", path);
+    set->mapped = base;
+    set->mapped_size = size;
+    set->vectors = (uint64_t*)((unsigned char*)base + sizeof(HDEncodedHeader));
+    return set;
+}
+
+void free_encoded_set(HDEncodedSet* set) {
+    if (set) {
+        if (set->mapped) {
+            munmap(set->mapped, set->mapped_size);
+        } else {
+            free(set->vectors);
+        }
+        free(set);
+    }
+}
@@ -0,0 +1,43 @@
+// hd_encoded.h - Sets of encoded samples, kept in RAM or in mmapped spill files
+#ifndef HD_ENCODED_H
+#define HD_ENCODED_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "hd_vector.h"
+
+// Packed encodings of a run of samples, one HD_ROW_WORDS(dimension) row each.
+// 'key' identifies the model configuration and sample content they came from;
+// 'check' is an independent hash of the same, compared along with it.
+typedef struct {
+    uint64_t key;
+    uint64_t check;
+    int n_samples;
+    int dimension;
+    int stride;              // Words between rows
+    uint64_t* vectors;       // n_samples rows
+    void* mapped;            // Spill file mapping (NULL if the rows are in RAM)
+    size_t mapped_size;
+    char path[256];          // Spill file (empty if in RAM)
+} HDEncodedSet;
+
+// Row of sample i
+static inline uint64_t* encoded_row(const HDEncodedSet* set, int i) {
+    return hd_row(set->vectors, set->stride, i);
+}
+
+// In-memory set (rows uninitialized)
+HDEncodedSet* init_encoded_set(uint64_t key, uint64_t check, int n_samples, int dimension);
+
+// Spill files: create_encoded_spill maps a new, writable file under a
+// temporary name; commit_encoded_spill publishes it once the rows are filled.
+// open_encoded_spill maps an existing file if its key, check and shape match.
+HDEncodedSet* create_encoded_spill(const char* path, uint64_t key, uint64_t check, 
+                                   int n_samples, int dimension);
+int commit_encoded_spill(HDEncodedSet* set);
+HDEncodedSet* open_encoded_spill(const char* path, uint64_t key, uint64_t check, 
+                                 int n_samples, int dimension);
+
+void free_encoded_set(HDEncodedSet* set);
+
+#endif // HD_ENCODED_H
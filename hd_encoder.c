@@ -0,0 +1,105 @@
+// hd_encoder.c - Implementation of the reusable sample encoder
+#include "hd_encoder.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+HDEncoder* init_encoder(HDLevelVectors* hd, HDMapping* mapping,
+                        const uint64_t* item_memory, int feature_dimension) {
+    return init_item_encoder(hd, mapping, HD_ITEM_TABLE, item_memory, 0, feature_dimension);
+}
+
+// item_memory is only used by HD_ITEM_TABLE, item_seed only by HD_ITEM_PROCEDURAL
+HDEncoder* init_item_encoder(HDLevelVectors* hd, HDMapping* mapping, HDItemMode item_mode,
+                             const uint64_t* item_memory, uint64_t item_seed, 
+                             int feature_dimension) {
+    if (!hd || !mapping || feature_dimension <= 0) return NULL;
+    if ((unsigned)item_mode >= HD_ITEM_MODE_COUNT) return NULL;
+    if (item_mode == HD_ITEM_TABLE && !item_memory) return NULL;
+
+    HDEncoder* encoder = (HDEncoder*)malloc(sizeof(HDEncoder));
+    if (!encoder) return NULL;
+
+    encoder->dimension = hd->dimension;
+    encoder->feature_dimension = feature_dimension;
+    encoder->hd = hd;
+    encoder->mapping = mapping;
+    encoder->item_mode = item_mode;
+    encoder->item_memory = item_memory;
+    encoder->item_seed = item_seed;
+    encoder->bound_table = NULL;
+    encoder->doubled_levels = NULL;
+    encoder->doubled_stride = 0;
+    encoder->kernels = hd_select_encode_kernels(hd->dimension, feature_dimension);
+
+    // Allocate the scratch counters once
+    encoder->bundle = init_bundled_vector(hd->dimension);
+    if (!encoder->bundle) {
+        free(encoder);
+        return NULL;
+    }
+
+    // Rotation reads each level vector from a doubled copy
+    if (item_mode == HD_ITEM_PERMUTE) {
+        encoder->doubled_stride = HD_DOUBLED_WORDS(hd->dimension);
+        encoder->doubled_levels = (uint64_t*)malloc((size_t)hd->levels * encoder->doubled_stride * 
+                                                    sizeof(uint64_t));
+        if (!encoder->doubled_levels) {
+            free_encoder(encoder);
+            return NULL;
+        }
+        for (int l = 0; l < hd->levels; l++) {
+            double_hypervector(level_vector(hd, l), 
+                               hd_row(encoder->doubled_levels, encoder->doubled_stride, l),
+                               hd->dimension);
+        }
+    }
+
+    return encoder;
+}
+
+void free_encoder(HDEncoder* encoder) {
+    if (encoder) {
+        free_bundled_vector(encoder->bundle);
+        free(encoder->doubled_levels);
+        free(encoder);
+    }
+}
+
+void attach_bound_table(HDEncoder* encoder, const uint64_t* bound_table) {
+    encoder->bound_table = encoder->item_mode == HD_ITEM_TABLE ? bound_table : NULL;
+}
+
+const uint64_t* encode_features(HDEncoder* encoder, const unsigned char* features,
+                                uint64_t* result) {
+    // Binding and bundling in one streaming pass
+    bundle_features(encoder, features, encoder->bundle);
+
+    if (!result) {
+        return encoder->bundle->final_vector;
+    }
+    copy_hypervector(result, encoder->bundle->final_vector, encoder->dimension);
+    return result;
+}
+
+void bundle_features(const HDEncoder* encoder, const unsigned char* features,
+                     BundledVector* bundle) {
+    if (encoder->item_mode == HD_ITEM_PROCEDURAL) {
+        bind_and_bundle_seeded(features, encoder->hd, encoder->mapping, encoder->item_seed,
+                               encoder->feature_dimension, bundle);
+    } else if (encoder->item_mode == HD_ITEM_PERMUTE) {
+        bind_and_bundle_permuted(features, encoder->mapping, encoder->doubled_levels,
+                                 encoder->doubled_stride, encoder->feature_dimension, bundle);
+    } else if (encoder->bound_table && encoder->kernels) {
+        encoder->kernels->bundle_bound_rows(features, encoder->mapping->level_lut,
+                                            encoder->bound_table, encoder->hd->levels, bundle);
+    } else if (encoder->bound_table) {
+        bundle_bound_rows(features, encoder->mapping, encoder->bound_table, encoder->hd->levels,
+                          encoder->feature_dimension, bundle);
+    } else if (encoder->kernels && encoder->mapping->level_source == encoder->hd) {
+        encoder->kernels->bind_and_bundle(features, encoder->mapping->vector_lut,
+                                          encoder->item_memory, bundle);
+    } else {
+        bind_and_bundle(features, encoder->hd, encoder->mapping, encoder->item_memory,
+                        encoder->feature_dimension, bundle);
+    }
+}
@@ -0,0 +1,58 @@
+// hd_encoder.h - Reusable sample encoder workspace
+#ifndef HD_ENCODER_H
+#define HD_ENCODER_H
+
+#include <stdint.h>
+#include "hd_level.h"
+#include "hd_mapping.h"
+#include "hd_bundling.h"
+#include "hd_kernels.h"
+
+// Where the per-feature item vectors come from
+typedef enum {
+    HD_ITEM_TABLE = 0,          // Stored item memory table
+    HD_ITEM_PROCEDURAL,         // Regenerated from the seed while encoding (no table)
+    HD_ITEM_PERMUTE,            // No item vectors: feature i rotates its level vector by i bits
+    HD_ITEM_MODE_COUNT
+} HDItemMode;
+
+// Scratch buffers for encoding one sample at a time. Create one encoder per
+// thread and reuse it for every sample; encoding never touches the heap.
+// Binding and bundling are fused, so no per-feature bound vectors are stored.
+typedef struct {
+    int dimension;                // Vector dimension
+    int feature_dimension;        // Number of features per sample
+    HDLevelVectors* hd;           // Level vectors (not owned)
+    HDMapping* mapping;           // Value-to-level mapping (not owned)
+    HDItemMode item_mode;
+    const uint64_t* item_memory;  // Item rows, HD_ROW_WORDS(dimension) apart (not owned)
+    uint64_t item_seed;           // Item vector seed (HD_ITEM_PROCEDURAL)
+    const uint64_t* bound_table;  // Optional level XOR item rows (HD_ITEM_TABLE, not owned)
+    uint64_t* doubled_levels;     // Doubled level vectors for rotation (HD_ITEM_PERMUTE)
+    int doubled_stride;           // Words between doubled level vectors
+    const HDEncodeKernels* kernels; // Specialized for this configuration, or NULL
+    BundledVector* bundle;        // Counter scratch, also the default output
+} HDEncoder;
+
+// Function declarations
+HDEncoder* init_encoder(HDLevelVectors* hd, HDMapping* mapping,
+                        const uint64_t* item_memory, int feature_dimension);
+HDEncoder* init_item_encoder(HDLevelVectors* hd, HDMapping* mapping, HDItemMode item_mode,
+                             const uint64_t* item_memory, uint64_t item_seed, 
+                             int feature_dimension);
+void free_encoder(HDEncoder* encoder);
+
+// Use a bound table built by fill_bound_table for the same level vectors
+// and item memory (NULL binds on the fly again)
+void attach_bound_table(HDEncoder* encoder, const uint64_t* bound_table);
+
+// Encode one sample into 'result' (HD_WORDS(dimension) words). If result is
+// NULL the encoder's own output vector is used. Returns the encoded vector.
+const uint64_t* encode_features(HDEncoder* encoder, const unsigned char* features,
+                                uint64_t* result);
+
+// Bind and bundle one sample into 'bundle' according to the encoder's item mode
+void bundle_features(const HDEncoder* encoder, const unsigned char* features,
+                     BundledVector* bundle);
+
+#endif // HD_ENCODER_H
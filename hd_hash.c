@@ -0,0 +1,51 @@
+// hd_hash.c - Hashes used to identify cached data
+#include "hd_hash.h"
+#include "hd_random.h"
+#include <string.h>
+
+uint64_t hd_hash_bytes(uint64_t hash, const void* data, size_t size) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static inline uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+// Lane a chains the SplitMix64 finalizer, lane b an xxHash64-style round
+static inline void hash_word(HDHash* hash, uint64_t word) {
+    hash->a = hd_mix64(hash->a ^ word);
+    hash->b = rotl64(hash->b + word * 0xc2b2ae3d27d4eb4fULL, 31) * 0x9e3779b185ebca87ULL;
+}
+
+void hd_hash_init(HDHash* hash, uint64_t seed) {
+    hash->a = seed;
+    hash->b = hd_mix64(seed + HD_RANDOM_GAMMA);
+}
+
+void hd_hash_words(HDHash* hash, const void* data, size_t size) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    size_t i = 0;
+
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        hash_word(hash, word);
+    }
+    if (i < size) {
+        uint64_t word = 0;
+        memcpy(&word, bytes + i, size - i);
+        hash_word(hash, word);
+    }
+    // The length keeps runs that differ only in trailing zeros apart
+    hash_word(hash, (uint64_t)size);
+}
+
+void hd_hash_combine(HDHash* hash, const HDHash* part) {
+    hash_word(hash, part->a);
+    hash_word(hash, part->b);
+}
@@ -0,0 +1,26 @@
+// hd_hash.h - Hashes used to identify cached data
+#ifndef HD_HASH_H
+#define HD_HASH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define HD_HASH_SEED 0xcbf29ce484222325ULL
+
+// Incremental 64-bit FNV-1a, for short keys (names, sizes, timestamps)
+uint64_t hd_hash_bytes(uint64_t hash, const void* data, size_t size);
+
+// Word-wise hash for bulk data: 8 bytes per step into two independent
+// 64-bit lanes, so a cached result can be checked against both
+typedef struct {
+    uint64_t a;
+    uint64_t b;
+} HDHash;
+
+void hd_hash_init(HDHash* hash, uint64_t seed);
+void hd_hash_words(HDHash* hash, const void* data, size_t size);
+
+// Fold one finished hash into another (e.g. per-chunk hashes, in order)
+void hd_hash_combine(HDHash* hash, const HDHash* part);
+
+#endif // HD_HASH_H
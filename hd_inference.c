@@ -31,28 +31,17 @@ void free_inference_result(InferenceResult* result) {
 }
 
 BundledVector* encode_test_sample(unsigned char* features, HDLevelVectors* hd, 
-                                HDMapping* mapping, char** item_memory, 
+                                HDMapping* mapping, const uint64_t* item_memory, 
                                 int feature_dimension, int dimension) {
-    // 1. Create bound vectors
-    BoundVectors* bound = init_bound_vectors(dimension, feature_dimension);
-    if (!bound) {
-        printf("Failed to initialize bound vectors for test sample\n");
-        return NULL;
-    }
-
-    // 2. Binding
-    bind_features(features, hd, mapping, item_memory, bound);
-
-    // 3. Bundling
+    // Fused binding and bundling (no bound vectors are materialized)
     BundledVector* bundle = init_bundled_vector(dimension);
     if (!bundle) {
         printf("Failed to initialize bundle vector for test sample\n");
-        free_bound_vectors(bound);
         return NULL;
     }
 
-    bundle_vectors(bound, bundle);
-    free_bound_vectors(bound);
+    bind_and_bundle(features, hd, mapping, item_memory, feature_dimension, bundle);
+    decode_bundle_counts(bundle);
 
     return bundle;
 }
\ No newline at end of file
@@ -18,7 +18,7 @@ typedef struct {
 InferenceResult* init_inference_result(int n_classes);
 void free_inference_result(InferenceResult* result);
 BundledVector* encode_test_sample(unsigned char* features, HDLevelVectors* hd, 
-                                HDMapping* mapping, char** item_memory, 
+                                HDMapping* mapping, const uint64_t* item_memory, 
                                 int feature_dimension, int dimension);
 
 #endif // HD_INFERENCE_H
\ No newline at end of file
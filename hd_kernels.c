@@ -0,0 +1,204 @@
+// hd_kernels.c - Encoding kernels specialized for the configurations in config.h
+#include "hd_kernels.h"
+#include "config.h"
+#include <string.h>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define HD_KERNELS_X86 1
+#else
+#define HD_KERNELS_X86 0
+#endif
+
+/*
+ * The generic kernels in hd_bundling.c take every bound from the bundle at
+ * run time and ripple carries only as far as they go. Here the word count,
+ * plane count, block count and threshold are constants: each specialization
+ * instantiates the bodies below with literal values, so every loop has a
+ * fixed trip count, carries ripple through all planes without branching,
+ * and the word loops vectorize. The counters are left exactly as the
+ * generic kernels leave them.
+ */
+
+// Bound row of feature i: a bound table row, or level XOR item (bind)
+static inline __attribute__((always_inline))
+void block_rows(const unsigned char* features, int i, const int bind, const int* level_lut,
+                const uint64_t* bound_table, int levels, uint64_t* const* vector_lut,
+                const uint64_t* item_memory, const int stride, const uint64_t** first,
+                const uint64_t** second) {
+    for (int k = 0; k < HD_BUNDLE_BLOCK; k++) {
+        unsigned char value = features[i + k];
+        if (bind) {
+            first[k] = vector_lut[value];
+            second[k] = item_memory + (size_t)(i + k) * stride;
+        } else {
+            first[k] = bound_table + ((size_t)(i + k) * levels + level_lut[value]) * stride;
+            second[k] = NULL;
+        }
+    }
+}
+
+static inline __attribute__((always_inline))
+void count_fixed(const unsigned char* features, const int bind, const int* level_lut,
+                 const uint64_t* bound_table, int levels, uint64_t* const* vector_lut,
+                 const uint64_t* item_memory, BundledVector* bundle, const int dimension,
+                 const int feature_dimension) {
+    enum { BLOCK = HD_BUNDLE_BLOCK };
+    const int words = HD_WORDS(dimension);
+    const int stride = HD_ROW_WORDS(dimension);
+    const int n_planes = counter_planes(feature_dimension);
+    const int threshold = feature_dimension / 2;
+    const int blocks_end = feature_dimension - feature_dimension % BLOCK;
+    uint64_t* restrict planes = bundle->planes;
+    uint64_t* restrict result = bundle->final_vector;
+    const uint64_t* first[BLOCK];
+    const uint64_t* second[BLOCK];
+
+    memset(planes, 0, (size_t)n_planes * words * sizeof(uint64_t));
+
+    for (int i = 0; i < blocks_end; i += BLOCK) {
+        block_rows(features, i, bind, level_lut, bound_table, levels, vector_lut, item_memory,
+                   stride, first, second);
+
+#pragma GCC ivdep
+        for (int w = 0; w < words; w++) {
+            uint64_t r[BLOCK];
+#pragma GCC unroll 8
+            for (int k = 0; k < BLOCK; k++) {
+                r[k] = bind ? first[k][w] ^ second[k][w] : first[k][w];
+            }
+
+            uint64_t o = planes[w], t = planes[words + w], f = planes[2 * words + w];
+            uint64_t twos_a, twos_b, fours_a, fours_b, carry;
+            carry_save_add(&twos_a, &o, o, r[0], r[1]);
+            carry_save_add(&twos_b, &o, o, r[2], r[3]);
+            carry_save_add(&fours_a, &t, t, twos_a, twos_b);
+            carry_save_add(&twos_a, &o, o, r[4], r[5]);
+            carry_save_add(&twos_b, &o, o, r[6], r[7]);
+            carry_save_add(&fours_b, &t, t, twos_a, twos_b);
+            carry_save_add(&carry, &f, f, fours_a, fours_b);
+            planes[w] = o;
+            planes[words + w] = t;
+            planes[2 * words + w] = f;
+
+#pragma GCC unroll 32
+            for (int p = 3; p < n_planes; p++) {
+                uint64_t bits = planes[p * words + w];
+                planes[p * words + w] = bits ^ carry;
+                carry &= bits;
+            }
+        }
+    }
+
+    // Leftover features, one ripple each
+    for (int i = blocks_end; i < feature_dimension; i++) {
+        const uint64_t* row = bind ? vector_lut[features[i]]
+                                   : bound_table + ((size_t)i * levels +
+                                                    level_lut[features[i]]) * stride;
+        const uint64_t* item = bind ? item_memory + (size_t)i * stride : row;
+
+        for (int w = 0; w < words; w++) {
+            uint64_t carry = bind ? row[w] ^ item[w] : row[w];
+#pragma GCC unroll 32
+            for (int p = 0; p < n_planes; p++) {
+                uint64_t bits = planes[p * words + w];
+                planes[p * words + w] = bits ^ carry;
+                carry &= bits;
+            }
+        }
+    }
+
+    // count > threshold, compared from the top plane down
+    for (int w = 0; w < words; w++) {
+        uint64_t greater = 0;
+        uint64_t equal = ~(uint64_t)0;
+#pragma GCC unroll 32
+        for (int p = n_planes - 1; p >= 0; p--) {
+            uint64_t bits = planes[p * words + w];
+            if ((threshold >> p) & 1) {
+                equal &= bits;
+            } else {
+                greater |= equal & bits;
+                equal &= ~bits;
+            }
+        }
+        result[w] = greater;
+    }
+    result[words - 1] &= hd_tail_mask(dimension);
+
+    bundle->n_planes = n_planes;
+    bundle->n_pending = 0;
+}
+
+#define HD_DEFINE_ENCODE_KERNELS(suffix, attr, dimension, feature_dimension)           \
+attr static void bundle_bound_rows_##suffix(const unsigned char* features,            \
+                                            const int* level_lut,                     \
+                                            const uint64_t* bound_table, int levels,  \
+                                            BundledVector* bundle) {                  \
+    count_fixed(features, 0, level_lut, bound_table, levels, NULL, NULL, bundle,      \
+                dimension, feature_dimension);                                        \
+}                                                                                     \
+attr static void bind_and_bundle_##suffix(const unsigned char* features,              \
+                                          uint64_t* const* vector_lut,                \
+                                          const uint64_t* item_memory,                \
+                                          BundledVector* bundle) {                    \
+    count_fixed(features, 1, NULL, NULL, 0, vector_lut, item_memory, bundle,          \
+                dimension, feature_dimension);                                        \
+}
+
+// One kernel set per vector extension for each configuration
+#if HD_KERNELS_X86
+#define HD_DEFINE_KERNEL_SET(name, dimension, feature_dimension)                          \
+HD_DEFINE_ENCODE_KERNELS(name, , dimension, feature_dimension)                            \
+HD_DEFINE_ENCODE_KERNELS(name##_avx2, __attribute__((target("avx2"))),                    \
+                         dimension, feature_dimension)                                    \
+HD_DEFINE_ENCODE_KERNELS(name##_avx512, __attribute__((target("avx512f"))),               \
+                         dimension, feature_dimension)                                    \
+static const HDEncodeKernels name##_kernels[] = {                                         \
+    { #name, dimension, feature_dimension, bundle_bound_rows_##name,                      \
+      bind_and_bundle_##name },                                                           \
+    { #name " (AVX2)", dimension, feature_dimension, bundle_bound_rows_##name##_avx2,     \
+      bind_and_bundle_##name##_avx2 },                                                    \
+    { #name " (AVX-512)", dimension, feature_dimension, bundle_bound_rows_##name##_avx512,\
+      bind_and_bundle_##name##_avx512 },                                                  \
+};
+#else
+#define HD_DEFINE_KERNEL_SET(name, dimension, feature_dimension)                          \
+HD_DEFINE_ENCODE_KERNELS(name, , dimension, feature_dimension)                            \
+static const HDEncodeKernels name##_kernels[] = {                                         \
+    { #name, dimension, feature_dimension, bundle_bound_rows_##name,                      \
+      bind_and_bundle_##name },                                                           \
+};
+#endif
+
+// The dataset configurations of config.h (FMNIST shares the MNIST size)
+HD_DEFINE_KERNEL_SET(mnist, HD_DIMENSION, MNIST_IMAGE_SIZE)
+HD_DEFINE_KERNEL_SET(ucihar, HD_DIMENSION, UCIHAR_FEATURE_COUNT)
+HD_DEFINE_KERNEL_SET(isolet, HD_DIMENSION, ISOLET_FEATURE_COUNT)
+HD_DEFINE_KERNEL_SET(cifar10, HD_DIMENSION, CIFAR10_IMAGE_SIZE)
+HD_DEFINE_KERNEL_SET(connect4, HD_DIMENSION, CONNECT4_FEATURE_COUNT)
+
+static const HDEncodeKernels* const kernel_sets[] = {
+    mnist_kernels, ucihar_kernels, isolet_kernels, cifar10_kernels, connect4_kernels
+};
+
+// Index of the widest variant this CPU runs
+static int vector_variant(void) {
+#if HD_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return 2;
+    if (__builtin_cpu_supports("avx2")) return 1;
+#endif
+    return 0;
+}
+
+const HDEncodeKernels* hd_select_encode_kernels(int dimension, int feature_dimension) {
+    int n_sets = (int)(sizeof(kernel_sets) / sizeof(kernel_sets[0]));
+
+    for (int s = 0; s < n_sets; s++) {
+        const HDEncodeKernels* set = kernel_sets[s];
+        if (set->dimension == dimension && set->feature_dimension == feature_dimension) {
+            return &set[vector_variant()];
+        }
+    }
+    return NULL;
+}
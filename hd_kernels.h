@@ -0,0 +1,29 @@
+// hd_kernels.h - Encoding kernels specialized for the configurations in config.h
+#ifndef HD_KERNELS_H
+#define HD_KERNELS_H
+
+#include <stdint.h>
+#include "hd_bundling.h"
+
+// Fused bind + bundle of one sample, with the dimension and feature count
+// fixed at compile time. level_lut / vector_lut are the HDMapping tables.
+typedef void (*HDBundleRowsFn)(const unsigned char* features, const int* level_lut,
+                               const uint64_t* bound_table, int levels, BundledVector* bundle);
+typedef void (*HDBindBundleFn)(const unsigned char* features, uint64_t* const* vector_lut,
+                               const uint64_t* item_memory, BundledVector* bundle);
+
+// One specialization. The results equal bundle_bound_rows / bind_and_bundle
+// (counters included), so it can be swapped in for the generic kernels.
+typedef struct {
+    const char* name;
+    int dimension;
+    int feature_dimension;
+    HDBundleRowsFn bundle_bound_rows;  // Rows from a bound table
+    HDBindBundleFn bind_and_bundle;    // Level XOR item rows on the fly
+} HDEncodeKernels;
+
+// Kernels for this configuration, compiled for the widest vector extension
+// the running CPU supports, or NULL if none was generated (generic path)
+const HDEncodeKernels* hd_select_encode_kernels(int dimension, int feature_dimension);
+
+#endif // HD_KERNELS_H
@@ -1,42 +1,38 @@
+#include "hd_level.h"
+#include "hd_random.h"
 #include <stdio.h>
 #include <stdlib.h>
-#include <time.h>
 #include <math.h>
 
 
 
-typedef struct {
-    int levels;        
-    int dimension;     
-    float randomness;  // 隨機参数 (0 到 1 間)
-    char **vectors;    
-} HDLevelVectors;
-
-void free_level_vectors(HDLevelVectors* hd);
-void generate_random_vector(char *vector, int dimension);
-void interpolate_vectors(char *result, const char *vec1, const char *vec2, 
+void interpolate_vectors(uint64_t *result, const uint64_t *vec1, const uint64_t *vec2, 
                          const float *threshold, float t, int dimension);
-int hamming_distance(char* vec1, char* vec2, int dimension);
-void print_vector(char* vector, int dimension);
-
-// 生成随机二进制向量
-void generate_random_vector(char *vector, int dimension) {
-    for (int i = 0; i < dimension; i++) {
-        vector[i] = rand() % 2;
-    }
-}
 
 // 根据阈值向量进行插值，类似torchhd中的torch.where函数
-void interpolate_vectors(char *result, const char *vec1, const char *vec2, 
+void interpolate_vectors(uint64_t *result, const uint64_t *vec1, const uint64_t *vec2, 
                          const float *threshold, float t, int dimension) {
-    for (int i = 0; i < dimension; i++) {
-        // 如果阈值小于t，选择vec1的值，否则选择vec2的值
-        result[i] = (threshold[i] < t) ? vec1[i] : vec2[i];
+    // 先建立選擇遮罩，再逐word合併
+    int words = HD_WORDS(dimension);
+    for (int w = 0; w < words; w++) {
+        uint64_t mask = 0;
+        for (int b = 0; b < HD_WORD_BITS && w * HD_WORD_BITS + b < dimension; b++) {
+            // 如果阈值小于t，选择vec1的值，否则选择vec2的值
+            if (threshold[w * HD_WORD_BITS + b] < t) mask |= (uint64_t)1 << b;
+        }
+        result[w] = (vec1[w] & mask) | (vec2[w] & ~mask);
     }
 }
 
+// level 向量表在 arena 中所佔的位元組數
+size_t level_vectors_bytes(int levels, int dimension) {
+    return arena_footprint((size_t)levels * HD_ROW_WORDS(dimension) * sizeof(uint64_t));
+}
+
 // TorchHD风格的初始化函数
-HDLevelVectors* init_level_vectors(int num_vectors, int dimension, float randomness) {
+// arena 為 NULL 時自行建立一個私有 arena; 相同 seed 產生相同的向量
+HDLevelVectors* init_level_vectors(int num_vectors, int dimension, float randomness, uint64_t seed,
+                                   HDArena* arena) {
     if (num_vectors <= 0 || dimension <= 0 || randomness < 0 || randomness > 1) {
         return NULL;
     }
@@ -49,72 +45,55 @@ HDLevelVectors* init_level_vectors(int num_vectors, int dimension, float randomn
     hd->levels = num_vectors;
     hd->dimension = dimension;
     hd->randomness = randomness;
+    hd->stride = HD_ROW_WORDS(dimension);
+    hd->arena = NULL;
     
-    // 分配向量数组内存
-    hd->vectors = (char**)malloc(num_vectors * sizeof(char*));
-    if (!hd->vectors) {
-        free(hd);
-        return NULL;
-    }
-    
-    // 为每个level分配内存
-    for (int i = 0; i < num_vectors; i++) {
-        hd->vectors[i] = (char*)malloc(dimension * sizeof(char));
-        if (!hd->vectors[i]) {
-            // 清理已分配的内存
-            for (int j = 0; j < i; j++) {
-                free(hd->vectors[j]);
-            }
-            free(hd->vectors);
+    if (!arena) {
+        hd->arena = init_arena(level_vectors_bytes(num_vectors, dimension));
+        if (!hd->arena) {
             free(hd);
             return NULL;
         }
+        arena = hd->arena;
     }
-    
-    // 初始化隨機生成器
-    srand(time(NULL));
 
+    // 所有level向量放在同一塊連續記憶體
+    hd->vectors = (uint64_t*)arena_alloc(arena, (size_t)num_vectors * hd->stride * sizeof(uint64_t));
+    if (!hd->vectors) {
+        free_level_vectors(hd);
+        return NULL;
+    }
+    
     // 計算span,可以參考torchhd實現方式
     float levels_per_span = (1 - randomness) * (num_vectors - 1) + randomness * 1;
     levels_per_span = (levels_per_span < 1) ? 1 : levels_per_span; // 至少為1
     float span = (num_vectors - 1) / levels_per_span;
     int span_count = (int)ceilf(span + 1);
 
-    // 生成基礎向量 (類似span_hv)
-    char **span_vectors = (char**)malloc(span_count * sizeof(char*));
+    // 生成基礎向量 (類似span_hv), 暫存於連續區塊
+    int words = HD_WORDS(dimension);
+    uint64_t *span_vectors = (uint64_t*)calloc((size_t)span_count * words, sizeof(uint64_t));
     if (!span_vectors) {
         free_level_vectors(hd);
         return NULL;
     }
     
     for (int i = 0; i < span_count; i++) {
-        span_vectors[i] = (char*)malloc(dimension * sizeof(char));
-        if (!span_vectors[i]) {
-            // 清理
-            for (int j = 0; j < i; j++) {
-                free(span_vectors[j]);
-            }
-            free(span_vectors);
-            free_level_vectors(hd);
-            return NULL;
-        }
-        generate_random_vector(span_vectors[i], dimension);
+        hd_random_vector(hd_row(span_vectors, words, i), dimension, seed, HD_STREAM_LEVEL_SPAN | i);
     }
     
-    // 生成閥值向量 (類似threshold_v)
+// 生成閥值向量 (類似threshold_v)
     float *threshold = (float*)malloc(dimension * sizeof(float));
     if (!threshold) {
         // 清理
-        for (int i = 0; i < span_count; i++) {
-            free(span_vectors[i]);
-        }
         free(span_vectors);
         free_level_vectors(hd);
         return NULL;
     }
     
+    uint64_t threshold_key = hd_stream_key(seed, HD_STREAM_LEVEL_THRESHOLD);
     for (int i = 0; i < dimension; i++) {
-        threshold[i] = (float)rand() / RAND_MAX; // 0到1之間之隨機值
+        threshold[i] = hd_random_unit(hd_random_word(threshold_key, i)); // 0到1之間之隨機值
     }
     
     // 爲每個level生成向量
@@ -124,9 +103,7 @@ HDLevelVectors* init_level_vectors(int num_vectors, int dimension, float randomn
         // 特殊情況：如果在span邊界上
         if (fabs(fmod(i, levels_per_span)) < 1e-12) {
             // 直接使用該span的正交向量
-            for (int j = 0; j < dimension; j++) {
-                hd->vectors[i][j] = span_vectors[span_idx][j];
-            }
+            copy_hypervector(level_vector(hd, i), hd_row(span_vectors, words, span_idx), dimension);
         } else {
             // 計算在當前span内的位置
             float level_within_span = fmod(i, levels_per_span);
@@ -134,41 +111,49 @@ HDLevelVectors* init_level_vectors(int num_vectors, int dimension, float randomn
             float t = 1 - (level_within_span / levels_per_span);
             
             // 在兩個基礎向量之間進行插值
-            interpolate_vectors(hd->vectors[i], 
-                              span_vectors[span_idx], 
-                              span_vectors[span_idx + 1], 
+            interpolate_vectors(level_vector(hd, i), 
+                              hd_row(span_vectors, words, span_idx), 
+                              hd_row(span_vectors, words, span_idx + 1), 
                               threshold, t, dimension);
         }
     }
     
     // 清理記憶體
-    for (int i = 0; i < span_count; i++) {
-        free(span_vectors[i]);
-    }
     free(span_vectors);
     free(threshold);
     
     return hd;
 }
 
+// 以既有的連續向量表 (例如映射進來的模型檔) 建立 level 向量, 不複製資料
+HDLevelVectors* wrap_level_vectors(int levels, int dimension, float randomness, uint64_t* vectors) {
+    HDLevelVectors* hd = (HDLevelVectors*)malloc(sizeof(HDLevelVectors));
+    if (!hd) return NULL;
+
+    hd->levels = levels;
+    hd->dimension = dimension;
+    hd->randomness = randomness;
+    hd->stride = HD_ROW_WORDS(dimension);
+    hd->vectors = vectors;
+    hd->arena = NULL;
+
+    return hd;
+}
+
 // 釋放記憶體
 void free_level_vectors(HDLevelVectors* hd) {
     if (hd) {
-        if (hd->vectors) {
-            for (int i = 0; i < hd->levels; i++) {
-                free(hd->vectors[i]);
-            }
-            free(hd->vectors);
-        }
+        // 向量位於外部 arena 時由 arena 的擁有者釋放
+        free_arena(hd->arena);
         free(hd);
     }
 }
 
 // 
-void print_vector(char* vector, int dimension) {
+void print_vector(const uint64_t* vector, int dimension) {
     printf("[");
     for (int i = 0; i < dimension; i++) {
-        printf("%d", vector[i]);
+        printf("%d", hd_get_bit(vector, i));
         if (i < dimension - 1) printf(",");
     }
     printf("]\n");
@@ -4,18 +4,31 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
+#include <stdint.h>
+#include "hd_vector.h"
+#include "hd_arena.h"
 
 // 定義向量結構
 typedef struct {
     int levels;         // 總共的level數量
     int dimension;      // 向量維度
-    int randomness;      //  randomness
-    char **vectors;     // 存儲所有level的向量
+    float randomness;   //  randomness
+    int stride;         // 相鄰level向量間隔的word數
+    uint64_t *vectors;  // 所有level的向量, 連續存放 (packed)
+    HDArena *arena;     // 私有 arena (NULL 表示向量位於外部 arena)
 } HDLevelVectors;
 
+// 取得第 level 個向量
+static inline uint64_t* level_vector(const HDLevelVectors* hd, int level) {
+    return hd_row(hd->vectors, hd->stride, level);
+}
+
 // 函數聲明
-HDLevelVectors* init_level_vectors(int levels, int dimension, float randomness);
+size_t level_vectors_bytes(int levels, int dimension);
+HDLevelVectors* init_level_vectors(int levels, int dimension, float randomness, uint64_t seed,
+                                   HDArena* arena);
+HDLevelVectors* wrap_level_vectors(int levels, int dimension, float randomness, uint64_t* vectors);
 void free_level_vectors(HDLevelVectors* hd);
-void print_vector(char* vector, int dimension);
+void print_vector(const uint64_t* vector, int dimension);
 
 #endif
\ No newline at end of file
@@ -3,8 +3,8 @@
 #include <stdlib.h>
 
 
-
-int get_level_index(HDMapping* mapping, int value) {
+// 線性掃描閾值, 只在建立查表時與查表範圍外的輸入使用
+static int scan_level_index(HDMapping* mapping, int value) {
     // 檢查是否在範圍內
     if (value < mapping->input_min) return 0;
     if (value >= mapping->input_max) return mapping->n_levels - 1;
@@ -22,15 +22,32 @@ int get_level_index(HDMapping* mapping, int value) {
     return level;
 }
 
-char* get_level_vector(HDLevelVectors* hd, int value, HDMapping* mapping) {
+int get_level_index(HDMapping* mapping, int value) {
+    // 8-bit 輸入直接查表
+    if (value >= 0 && value < HD_MAPPING_LUT_SIZE) {
+        return mapping->level_lut[value];
+    }
+    return scan_level_index(mapping, value);
+}
+
+uint64_t* get_level_vector(HDLevelVectors* hd, int value, HDMapping* mapping) {
+    if (hd == mapping->level_source && value >= 0 && value < HD_MAPPING_LUT_SIZE) {
+        return mapping->vector_lut[value];
+    }
+
     int level_index = get_level_index(mapping, value);
-    
+    return level_vector(hd, level_index);
+}
 
-    
-    return hd->vectors[level_index];
+// 建立輸入值 -> level vector 指標的查表, 之後映射只需一次載入
+void attach_level_vectors(HDMapping* mapping, HDLevelVectors* hd) {
+    for (int v = 0; v < HD_MAPPING_LUT_SIZE; v++) {
+        mapping->vector_lut[v] = level_vector(hd, mapping->level_lut[v]);
+    }
+    mapping->level_source = hd;
 }
 
-void encode_mnist_image(HDLevelVectors* hd, unsigned char* image, char** encoded_image, 
+void encode_mnist_image(HDLevelVectors* hd, unsigned char* image, uint64_t** encoded_image, 
                        int image_size, HDMapping* mapping) {
     //printf("Encoding image:\n");
     for (int i = 0; i < image_size; i++) {
@@ -67,6 +84,12 @@ HDMapping* init_mapping(int input_min, int input_max, int n_levels) {
         printf("Threshold[%d] = %d\n", i, mapping->thresholds[i]);
     }
 
+    // 預先計算所有 8-bit 輸入值的 level 索引
+    for (int v = 0; v < HD_MAPPING_LUT_SIZE; v++) {
+        mapping->level_lut[v] = scan_level_index(mapping, v);
+    }
+    mapping->level_source = NULL;
+
     return mapping;
 }
 
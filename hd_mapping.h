@@ -5,20 +5,27 @@
 #include "mnist_loader.h"
 #include "hd_level.h"
 
+// 8-bit 輸入值的查表大小
+#define HD_MAPPING_LUT_SIZE 256
+
 // 定義映射結構
 typedef struct {
     int input_min;      // 輸入範圍最小值 (0)
     int input_max;      // 輸入範圍最大值 (255)
     int n_levels;       // level數量
     int* thresholds;    // 儲存每個level的閾值
+    int level_lut[HD_MAPPING_LUT_SIZE];         // 輸入值 -> level 索引
+    HDLevelVectors* level_source;               // vector_lut 所指向的 level vectors
+    uint64_t* vector_lut[HD_MAPPING_LUT_SIZE];  // 輸入值 -> level vector
 } HDMapping;
 
 // 函數聲明
 HDMapping* init_mapping(int input_min, int input_max, int n_levels);
 int get_level_index(HDMapping* mapping, int value);
-char* get_level_vector(HDLevelVectors* hd, int value, HDMapping* mapping);
+uint64_t* get_level_vector(HDLevelVectors* hd, int value, HDMapping* mapping);
+void attach_level_vectors(HDMapping* mapping, HDLevelVectors* hd);
 void free_mapping(HDMapping* mapping);
-void encode_mnist_image(HDLevelVectors* hd, unsigned char* image, char** encoded_image, 
+void encode_mnist_image(HDLevelVectors* hd, unsigned char* image, uint64_t** encoded_image, 
                        int image_size, HDMapping* mapping);
 
 #endif
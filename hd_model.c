@@ -0,0 +1,106 @@
+// hd_model.c - Layout and integrity checks for binary model files
+#include "hd_model.h"
+#include "hd_vector.h"
+#include "hd_arena.h"
+#include "hd_encoder.h"
+#include <stdio.h>
+#include <string.h>
+
+_Static_assert(sizeof(HDModelHeader) == 256, "model header must stay 256 bytes");
+_Static_assert(sizeof(HDModelHeader) % HD_ALIGNMENT == 0, "sections must stay aligned");
+
+// Fill in the identification fields and section offsets for a model
+void hd_model_layout(HDModelHeader* header, int dimension, int levels, int feature_dimension,
+                     int n_classes, int acc_stride, int item_mode) {
+    memset(header, 0, sizeof(HDModelHeader));
+    memcpy(header->magic, HD_MODEL_MAGIC, HD_MODEL_MAGIC_SIZE);
+    header->version = HD_MODEL_VERSION;
+    header->byte_order = HD_MODEL_BYTE_ORDER;
+    header->header_size = sizeof(HDModelHeader);
+    header->dimension = dimension;
+    header->levels = levels;
+    header->feature_dimension = feature_dimension;
+    header->n_classes = n_classes;
+    header->row_words = HD_ROW_WORDS(dimension);
+    header->acc_stride = acc_stride;
+    header->item_mode = item_mode;
+
+    size_t row_bytes = (size_t)header->row_words * sizeof(uint64_t);
+    size_t offset = sizeof(HDModelHeader);
+
+    header->level_offset = offset;
+    offset += arena_footprint((size_t)levels * row_bytes);
+    header->item_offset = offset;
+    if (item_mode == HD_ITEM_TABLE) {
+        offset += arena_footprint((size_t)feature_dimension * row_bytes);
+    }
+    header->class_offset = offset;
+    offset += arena_footprint((size_t)n_classes * row_bytes);
+    header->accumulator_offset = offset;
+    offset += arena_footprint((size_t)n_classes * acc_stride * sizeof(int32_t));
+    header->count_offset = offset;
+    offset += arena_footprint((size_t)n_classes * sizeof(int32_t));
+    header->file_size = offset;
+}
+
+// 64-bit FNV-1a over whole words. Section sizes are multiples of
+// HD_ALIGNMENT, so the payload never has a partial word.
+uint64_t hd_model_checksum(const void* data, size_t size) {
+    const uint64_t* words = (const uint64_t*)data;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    for (size_t i = 0; i < size / sizeof(uint64_t); i++) {
+        hash ^= words[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Check that a header describes a model this build can map in place
+int hd_model_validate(const HDModelHeader* header, size_t file_size) {
+    if (file_size < sizeof(HDModelHeader) || 
+        memcmp(header->magic, HD_MODEL_MAGIC, HD_MODEL_MAGIC_SIZE) != 0) {
+        printf("Not an HD model file\n");
+        return 0;
+    }
+    if (header->byte_order != HD_MODEL_BYTE_ORDER) {
+        printf("Model file was written on a host with a different byte order\n");
+        return 0;
+    }
+    if (header->version != HD_MODEL_VERSION || header->header_size != sizeof(HDModelHeader)) {
+        printf("Unsupported model file version %u\n", header->version);
+        return 0;
+    }
+    if (header->dimension <= 0 || header->levels <= 0 || 
+        header->feature_dimension <= 0 || header->n_classes <= 0) {
+        printf("Invalid model dimensions in file header\n");
+        return 0;
+    }
+    if (header->item_mode < 0 || header->item_mode >= HD_ITEM_MODE_COUNT) {
+        printf("Unsupported item memory mode %d in model file\n", header->item_mode);
+        return 0;
+    }
+
+    // The layout is fully determined by the dimensions; recompute and compare
+    HDModelHeader expected;
+    hd_model_layout(&expected, header->dimension, header->levels, header->feature_dimension,
+                    header->n_classes, header->acc_stride, header->item_mode);
+    if (header->acc_stride < header->dimension ||
+        header->row_words != expected.row_words ||
+        header->level_offset != expected.level_offset ||
+        header->item_offset != expected.item_offset ||
+        header->class_offset != expected.class_offset ||
+        header->accumulator_offset != expected.accumulator_offset ||
+        header->count_offset != expected.count_offset ||
+        header->file_size != expected.file_size) {
+        printf("Model file layout does not match its header\n");
+        return 0;
+    }
+    if (header->file_size != file_size) {
+        printf("Model file is truncated (%zu of %llu bytes)\n", 
+               file_size, (unsigned long long)header->file_size);
+        return 0;
+    }
+
+    return 1;
+}
@@ -0,0 +1,47 @@
+// hd_model.h - Binary, memory-mappable model file format
+#ifndef HD_MODEL_H
+#define HD_MODEL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define HD_MODEL_MAGIC "HDMODEL\0"
+#define HD_MODEL_MAGIC_SIZE 8
+#define HD_MODEL_VERSION 1
+#define HD_MODEL_BYTE_ORDER 0x01020304u  // Reads back swapped on a foreign-endian host
+
+// Fixed-size file header. Every section starts on an HD_ALIGNMENT boundary and
+// stores its rows exactly as they are kept in memory (HD_ROW_WORDS apart), so
+// a mapped file can be used in place.
+typedef struct {
+    char magic[HD_MODEL_MAGIC_SIZE];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t header_size;       // sizeof(HDModelHeader)
+    int32_t dimension;
+    int32_t levels;
+    int32_t feature_dimension;
+    int32_t n_classes;
+    float randomness;
+    int32_t row_words;          // 64-bit words per hypervector row
+    int32_t acc_stride;         // int32 counters per accumulator row
+    char dataset_name[64];
+    uint64_t level_offset;       // levels x row_words uint64_t
+    uint64_t item_offset;        // feature_dimension x row_words uint64_t (or empty)
+    uint64_t class_offset;       // n_classes x row_words uint64_t
+    uint64_t accumulator_offset; // n_classes x acc_stride int32_t
+    uint64_t count_offset;       // n_classes int32_t
+    uint64_t file_size;
+    uint64_t checksum;           // hd_model_checksum of bytes [header_size, file_size)
+    uint64_t seed;               // Seed the level and item tables came from (0 = unknown)
+    int32_t item_mode;           // HDItemMode; the item section is empty unless HD_ITEM_TABLE
+    uint8_t reserved[76];        // Zero; pads the header to 256 bytes
+} HDModelHeader;
+
+// Function declarations
+void hd_model_layout(HDModelHeader* header, int dimension, int levels, int feature_dimension,
+                     int n_classes, int acc_stride, int item_mode);
+uint64_t hd_model_checksum(const void* data, size_t size);
+int hd_model_validate(const HDModelHeader* header, size_t file_size);
+
+#endif // HD_MODEL_H
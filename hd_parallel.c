@@ -0,0 +1,230 @@
+// hd_parallel.c - Implementation of the persistent thread pool
+#include "hd_parallel.h"
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <stdatomic.h>
+
+typedef struct {
+    HDThreadPool* pool;
+    int thread_id;
+} WorkerInfo;
+
+// One shard of a parallel loop. Owner and thieves claim chunks from the same
+// counter, so every item is handed out exactly once. Aligned to a cache line
+// to keep the counters of different threads apart.
+typedef struct {
+    _Alignas(64) atomic_int next;
+    int end;
+} WorkRange;
+
+typedef struct {
+    WorkRange* ranges;
+    int chunk;
+    HDRangeFn fn;
+    void* arg;
+} LoopJob;
+
+// Number of threads to use when none is configured explicitly
+int hd_default_thread_count(void) {
+    if (HD_NUM_THREADS > 0) {
+        return HD_NUM_THREADS;
+    }
+
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    return online > 0 ? (int)online : 1;
+}
+
+static void* worker_main(void* arg) {
+    WorkerInfo* info = (WorkerInfo*)arg;
+    HDThreadPool* pool = info->pool;
+    int thread_id = info->thread_id;
+    unsigned long seen_generation = 0;
+    free(info);
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->shutdown && pool->generation == seen_generation) {
+            pthread_cond_wait(&pool->work_ready, &pool->lock);
+        }
+        if (pool->shutdown) break;
+
+        seen_generation = pool->generation;
+        HDTaskFn task = pool->task;
+        void* task_arg = pool->task_arg;
+        pthread_mutex_unlock(&pool->lock);
+
+        task(task_arg, thread_id, pool->n_threads);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0) {
+            pthread_cond_signal(&pool->work_done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+HDThreadPool* init_thread_pool(int n_threads) {
+    if (n_threads <= 0) {
+        n_threads = hd_default_thread_count();
+    }
+
+    HDThreadPool* pool = (HDThreadPool*)calloc(1, sizeof(HDThreadPool));
+    if (!pool) return NULL;
+
+    pool->n_threads = n_threads;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_ready, NULL);
+    pthread_cond_init(&pool->work_done, NULL);
+
+    if (n_threads == 1) {
+        return pool;  // Everything runs on the caller
+    }
+
+    pool->workers = (pthread_t*)malloc((n_threads - 1) * sizeof(pthread_t));
+    if (!pool->workers) {
+        free_thread_pool(pool);
+        return NULL;
+    }
+
+    for (int i = 1; i < n_threads; i++) {
+        WorkerInfo* info = (WorkerInfo*)malloc(sizeof(WorkerInfo));
+        if (info) {
+            info->pool = pool;
+            info->thread_id = i;
+        }
+        if (!info || pthread_create(&pool->workers[i - 1], NULL, worker_main, info) != 0) {
+            printf("Failed to start worker thread %d\n", i);
+            free(info);
+            // Keep the threads that did start
+            pool->n_threads = i;
+            break;
+        }
+    }
+
+    return pool;
+}
+
+void free_thread_pool(HDThreadPool* pool) {
+    if (!pool) return;
+
+    if (pool->workers) {
+        pthread_mutex_lock(&pool->lock);
+        pool->shutdown = 1;
+        pthread_cond_broadcast(&pool->work_ready);
+        pthread_mutex_unlock(&pool->lock);
+
+        for (int i = 1; i < pool->n_threads; i++) {
+            pthread_join(pool->workers[i - 1], NULL);
+        }
+        free(pool->workers);
+    }
+
+    pthread_cond_destroy(&pool->work_done);
+    pthread_cond_destroy(&pool->work_ready);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+}
+
+// Process-wide pool for work outside an HDContext (e.g. dataset loading).
+// Created on first use and shut down at exit; one user at a time.
+static pthread_mutex_t shared_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static HDThreadPool* shared_pool = NULL;
+
+static void free_shared_thread_pool(void) {
+    free_thread_pool(shared_pool);
+    shared_pool = NULL;
+}
+
+HDThreadPool* acquire_shared_thread_pool(void) {
+    pthread_mutex_lock(&shared_pool_lock);
+    if (!shared_pool) {
+        shared_pool = init_thread_pool(0);
+        if (!shared_pool) {
+            pthread_mutex_unlock(&shared_pool_lock);
+            return NULL;
+        }
+        atexit(free_shared_thread_pool);
+    }
+    return shared_pool;
+}
+
+void release_shared_thread_pool(HDThreadPool* pool) {
+    (void)pool;
+    pthread_mutex_unlock(&shared_pool_lock);
+}
+
+// Run the task on every thread and wait until all of them have finished
+void thread_pool_run(HDThreadPool* pool, HDTaskFn task, void* arg) {
+    if (pool->n_threads > 1) {
+        pthread_mutex_lock(&pool->lock);
+        pool->task = task;
+        pool->task_arg = arg;
+        pool->pending = pool->n_threads - 1;
+        pool->generation++;
+        pthread_cond_broadcast(&pool->work_ready);
+        pthread_mutex_unlock(&pool->lock);
+    }
+
+    task(arg, 0, pool->n_threads);
+
+    if (pool->n_threads > 1) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->pending > 0) {
+            pthread_cond_wait(&pool->work_done, &pool->lock);
+        }
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+void thread_pool_shard(int n_items, int thread_id, int n_threads, int* begin, int* end) {
+    *begin = (int)((long long)n_items * thread_id / n_threads);
+    *end = (int)((long long)n_items * (thread_id + 1) / n_threads);
+}
+
+// Drain this thread's own shard, then visit the others and steal from them
+static void loop_task(void* arg, int thread_id, int n_threads) {
+    LoopJob* job = (LoopJob*)arg;
+
+    for (int k = 0; k < n_threads; k++) {
+        WorkRange* range = &job->ranges[(thread_id + k) % n_threads];
+        for (;;) {
+            int begin = atomic_fetch_add_explicit(&range->next, job->chunk, 
+                                                  memory_order_relaxed);
+            if (begin >= range->end) break;
+            int end = begin + job->chunk < range->end ? begin + job->chunk : range->end;
+            job->fn(job->arg, begin, end, thread_id);
+        }
+    }
+}
+
+int thread_pool_for(HDThreadPool* pool, int n_items, int chunk, HDRangeFn fn, void* arg) {
+    if (n_items <= 0) return 1;
+    if (chunk <= 0) chunk = 1;
+
+    if (pool->n_threads == 1) {
+        fn(arg, 0, n_items, 0);
+        return 1;
+    }
+
+    WorkRange* ranges = (WorkRange*)aligned_alloc(64, pool->n_threads * sizeof(WorkRange));
+    if (!ranges) {
+        printf("Failed to allocate parallel loop ranges\n");
+        return 0;
+    }
+
+    for (int t = 0; t < pool->n_threads; t++) {
+        int begin, end;
+        thread_pool_shard(n_items, t, pool->n_threads, &begin, &end);
+        atomic_init(&ranges[t].next, begin);
+        ranges[t].end = end;
+    }
+
+    LoopJob job = { ranges, chunk, fn, arg };
+    thread_pool_run(pool, loop_task, &job);
+
+    free(ranges);
+    return 1;
+}
@@ -0,0 +1,45 @@
+// hd_parallel.h - Persistent thread pool for data-parallel HD operations
+#ifndef HD_PARALLEL_H
+#define HD_PARALLEL_H
+
+#include <pthread.h>
+
+// Loop body for thread_pool_for: processes items [begin, end) on thread_id
+typedef void (*HDRangeFn)(void* arg, int begin, int end, int thread_id);
+
+// Task executed once by every thread of the pool. thread_id runs from 0 to
+// n_threads - 1; the calling thread always takes thread_id 0.
+typedef void (*HDTaskFn)(void* arg, int thread_id, int n_threads);
+
+typedef struct {
+    int n_threads;               // Total threads, including the caller
+    pthread_t* workers;          // n_threads - 1 background threads
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;   // Signalled when a new task is posted
+    pthread_cond_t work_done;    // Signalled when the last worker finishes
+    HDTaskFn task;               // Current task
+    void* task_arg;              // Argument of the current task
+    unsigned long generation;    // Incremented for every posted task
+    int pending;                 // Background workers still running the task
+    int shutdown;                // Set when the pool is being destroyed
+} HDThreadPool;
+
+// Function declarations
+int hd_default_thread_count(void);
+HDThreadPool* init_thread_pool(int n_threads);
+void free_thread_pool(HDThreadPool* pool);
+void thread_pool_run(HDThreadPool* pool, HDTaskFn task, void* arg);
+
+// Process-wide pool (hd_default_thread_count threads) for code without an
+// HDContext. Held exclusively between acquire and release; NULL on failure.
+HDThreadPool* acquire_shared_thread_pool(void);
+void release_shared_thread_pool(HDThreadPool* pool);
+
+// Half-open range [*begin, *end) of n_items assigned to thread_id
+void thread_pool_shard(int n_items, int thread_id, int n_threads, int* begin, int* end);
+
+// Parallel loop over n_items in chunks. Every thread starts on its own shard
+// and, once it runs dry, steals remaining chunks from the other shards.
+int thread_pool_for(HDThreadPool* pool, int n_items, int chunk, HDRangeFn fn, void* arg);
+
+#endif // HD_PARALLEL_H
@@ -0,0 +1,264 @@
+// hd_popcount.c - XOR + popcount Hamming distance kernels with CPU dispatch
+#include "hd_popcount.h"
+#include <stdio.h>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define HD_POPCOUNT_X86 1
+#include <immintrin.h>
+#else
+#define HD_POPCOUNT_X86 0
+#endif
+
+typedef int (*HDHammingFn)(const uint64_t* a, const uint64_t* b, int words);
+typedef void (*HDHammingBatchFn)(const uint64_t* query, const uint64_t* rows, int stride,
+                                 int n_rows, int words, int* distances);
+
+// ---------------------------------------------------------------------------
+// Scalar kernels (also compiled with POPCNT enabled on x86)
+// ---------------------------------------------------------------------------
+
+#define HD_DEFINE_SCALAR_KERNELS(suffix, attr)                                  \
+attr static int hamming_##suffix(const uint64_t* a, const uint64_t* b,           \
+                                 int words) {                                    \
+    int distance = 0;                                                            \
+    for (int w = 0; w < words; w++) {                                            \
+        distance += __builtin_popcountll(a[w] ^ b[w]);                           \
+    }                                                                            \
+    return distance;                                                             \
+}                                                                                \
+attr static void hamming_batch_##suffix(const uint64_t* query,                  \
+                                        const uint64_t* rows, int stride,        \
+                                        int n_rows, int words, int* distances) { \
+    for (int r = 0; r < n_rows; r++) distances[r] = 0;                           \
+    for (int w = 0; w < words; w++) {                                            \
+        uint64_t q = query[w];                                                   \
+        for (int r = 0; r < n_rows; r++) {                                       \
+            const uint64_t* row = rows + (size_t)r * stride;                     \
+            distances[r] += __builtin_popcountll(q ^ row[w]);                    \
+        }                                                                        \
+    }                                                                            \
+}
+
+HD_DEFINE_SCALAR_KERNELS(scalar, )
+
+#if HD_POPCOUNT_X86
+HD_DEFINE_SCALAR_KERNELS(popcnt, __attribute__((target("popcnt"))))
+
+// ---------------------------------------------------------------------------
+// AVX2: per-nibble lookup table, byte counts summed with vpsadbw
+// ---------------------------------------------------------------------------
+
+__attribute__((target("avx2")))
+static inline __m256i popcount256(__m256i v) {
+    const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                         0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    __m256i lo = _mm256_and_si256(v, low_mask);
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+    __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lut, lo),
+                                     _mm256_shuffle_epi8(lut, hi));
+    return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+}
+
+__attribute__((target("avx2")))
+static inline int hsum256(__m256i v) {
+    __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    return (int)(_mm_cvtsi128_si64(sum) + _mm_extract_epi64(sum, 1));
+}
+
+__attribute__((target("avx2,popcnt")))
+static int hamming_avx2(const uint64_t* a, const uint64_t* b, int words) {
+    __m256i acc = _mm256_setzero_si256();
+    int w = 0;
+    for (; w + 4 <= words; w += 4) {
+        __m256i x = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(a + w)),
+                                     _mm256_loadu_si256((const __m256i*)(b + w)));
+        acc = _mm256_add_epi64(acc, popcount256(x));
+    }
+    int distance = hsum256(acc);
+    for (; w < words; w++) {
+        distance += __builtin_popcountll(a[w] ^ b[w]);
+    }
+    return distance;
+}
+
+// Rows are scored four at a time so each query chunk is loaded once per block
+__attribute__((target("avx2,popcnt")))
+static void hamming_batch_avx2(const uint64_t* query, const uint64_t* rows, int stride,
+                               int n_rows, int words, int* distances) {
+    int r = 0;
+    for (; r + 4 <= n_rows; r += 4) {
+        const uint64_t* r0 = rows + (size_t)r * stride;
+        const uint64_t *r1 = r0 + stride, *r2 = r1 + stride, *r3 = r2 + stride;
+        __m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256();
+        __m256i acc2 = _mm256_setzero_si256(), acc3 = _mm256_setzero_si256();
+        int w = 0;
+        for (; w + 4 <= words; w += 4) {
+            __m256i q = _mm256_loadu_si256((const __m256i*)(query + w));
+            acc0 = _mm256_add_epi64(acc0, popcount256(_mm256_xor_si256(q, _mm256_loadu_si256((const __m256i*)(r0 + w)))));
+            acc1 = _mm256_add_epi64(acc1, popcount256(_mm256_xor_si256(q, _mm256_loadu_si256((const __m256i*)(r1 + w)))));
+            acc2 = _mm256_add_epi64(acc2, popcount256(_mm256_xor_si256(q, _mm256_loadu_si256((const __m256i*)(r2 + w)))));
+            acc3 = _mm256_add_epi64(acc3, popcount256(_mm256_xor_si256(q, _mm256_loadu_si256((const __m256i*)(r3 + w)))));
+        }
+        int d0 = hsum256(acc0), d1 = hsum256(acc1), d2 = hsum256(acc2), d3 = hsum256(acc3);
+        for (; w < words; w++) {
+            d0 += __builtin_popcountll(query[w] ^ r0[w]);
+            d1 += __builtin_popcountll(query[w] ^ r1[w]);
+            d2 += __builtin_popcountll(query[w] ^ r2[w]);
+            d3 += __builtin_popcountll(query[w] ^ r3[w]);
+        }
+        distances[r] = d0;
+        distances[r + 1] = d1;
+        distances[r + 2] = d2;
+        distances[r + 3] = d3;
+    }
+    for (; r < n_rows; r++) {
+        distances[r] = hamming_avx2(query, rows + (size_t)r * stride, words);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// AVX-512 VPOPCNTDQ: native 64-bit lane popcount, masked tail loads
+// ---------------------------------------------------------------------------
+
+__attribute__((target("avx512f,avx512vpopcntdq")))
+static int hamming_avx512(const uint64_t* a, const uint64_t* b, int words) {
+    __m512i acc = _mm512_setzero_si512();
+    int w = 0;
+    for (; w + 8 <= words; w += 8) {
+        __m512i x = _mm512_xor_si512(_mm512_loadu_si512((const void*)(a + w)),
+                                     _mm512_loadu_si512((const void*)(b + w)));
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(x));
+    }
+    if (w < words) {
+        __mmask8 mask = (__mmask8)((1u << (words - w)) - 1);
+        __m512i x = _mm512_xor_si512(_mm512_maskz_loadu_epi64(mask, a + w),
+                                     _mm512_maskz_loadu_epi64(mask, b + w));
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(x));
+    }
+    return (int)_mm512_reduce_add_epi64(acc);
+}
+
+__attribute__((target("avx512f,avx512vpopcntdq")))
+static void hamming_batch_avx512(const uint64_t* query, const uint64_t* rows, int stride,
+                                 int n_rows, int words, int* distances) {
+    int r = 0;
+    for (; r + 4 <= n_rows; r += 4) {
+        const uint64_t* r0 = rows + (size_t)r * stride;
+        const uint64_t *r1 = r0 + stride, *r2 = r1 + stride, *r3 = r2 + stride;
+        __m512i acc0 = _mm512_setzero_si512(), acc1 = _mm512_setzero_si512();
+        __m512i acc2 = _mm512_setzero_si512(), acc3 = _mm512_setzero_si512();
+        for (int w = 0; w < words; w += 8) {
+            __mmask8 mask = (words - w >= 8) ? (__mmask8)0xFF
+                                             : (__mmask8)((1u << (words - w)) - 1);
+            __m512i q = _mm512_maskz_loadu_epi64(mask, query + w);
+            acc0 = _mm512_add_epi64(acc0, _mm512_popcnt_epi64(_mm512_xor_si512(q, _mm512_maskz_loadu_epi64(mask, r0 + w))));
+            acc1 = _mm512_add_epi64(acc1, _mm512_popcnt_epi64(_mm512_xor_si512(q, _mm512_maskz_loadu_epi64(mask, r1 + w))));
+            acc2 = _mm512_add_epi64(acc2, _mm512_popcnt_epi64(_mm512_xor_si512(q, _mm512_maskz_loadu_epi64(mask, r2 + w))));
+            acc3 = _mm512_add_epi64(acc3, _mm512_popcnt_epi64(_mm512_xor_si512(q, _mm512_maskz_loadu_epi64(mask, r3 + w))));
+        }
+        distances[r] = (int)_mm512_reduce_add_epi64(acc0);
+        distances[r + 1] = (int)_mm512_reduce_add_epi64(acc1);
+        distances[r + 2] = (int)_mm512_reduce_add_epi64(acc2);
+        distances[r + 3] = (int)_mm512_reduce_add_epi64(acc3);
+    }
+    for (; r < n_rows; r++) {
+        distances[r] = hamming_avx512(query, rows + (size_t)r * stride, words);
+    }
+}
+#endif // HD_POPCOUNT_X86
+
+// ---------------------------------------------------------------------------
+// Runtime dispatch
+// ---------------------------------------------------------------------------
+
+static HDHammingFn hamming_fn = NULL;
+static HDHammingBatchFn hamming_batch_fn = NULL;
+static HDPopcountBackend current_backend = HD_POPCOUNT_SCALAR;
+
+static int backend_supported(HDPopcountBackend backend) {
+    switch (backend) {
+        case HD_POPCOUNT_SCALAR:
+            return 1;
+#if HD_POPCOUNT_X86
+        case HD_POPCOUNT_POPCNT:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("popcnt");
+        case HD_POPCOUNT_AVX2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+        case HD_POPCOUNT_AVX512:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx512f") &&
+                   __builtin_cpu_supports("avx512vpopcntdq");
+#endif
+        default:
+            return 0;
+    }
+}
+
+int hd_popcount_set_backend(HDPopcountBackend backend) {
+    if (!backend_supported(backend)) {
+        return 0;
+    }
+
+    switch (backend) {
+#if HD_POPCOUNT_X86
+        case HD_POPCOUNT_POPCNT:
+            hamming_fn = hamming_popcnt;
+            hamming_batch_fn = hamming_batch_popcnt;
+            break;
+        case HD_POPCOUNT_AVX2:
+            hamming_fn = hamming_avx2;
+            hamming_batch_fn = hamming_batch_avx2;
+            break;
+        case HD_POPCOUNT_AVX512:
+            hamming_fn = hamming_avx512;
+            hamming_batch_fn = hamming_batch_avx512;
+            break;
+#endif
+        default:
+            hamming_fn = hamming_scalar;
+            hamming_batch_fn = hamming_batch_scalar;
+            break;
+    }
+    current_backend = backend;
+    return 1;
+}
+
+void hd_popcount_init(void) {
+    if (hamming_fn) return;
+
+    // Prefer the widest kernel the CPU supports
+    for (int backend = HD_POPCOUNT_BACKEND_COUNT - 1; backend >= 0; backend--) {
+        if (hd_popcount_set_backend((HDPopcountBackend)backend)) {
+            break;
+        }
+    }
+}
+
+HDPopcountBackend hd_popcount_get_backend(void) {
+    hd_popcount_init();
+    return current_backend;
+}
+
+const char* hd_popcount_backend_name(HDPopcountBackend backend) {
+    switch (backend) {
+        case HD_POPCOUNT_SCALAR: return "scalar";
+        case HD_POPCOUNT_POPCNT: return "popcnt";
+        case HD_POPCOUNT_AVX2:   return "avx2";
+        case HD_POPCOUNT_AVX512: return "avx512-vpopcntdq";
+        default:                 return "unknown";
+    }
+}
+
+int hd_hamming_words(const uint64_t* a, const uint64_t* b, int words) {
+    if (!hamming_fn) hd_popcount_init();
+    return hamming_fn(a, b, words);
+}
+
+void hd_hamming_batch(const uint64_t* query, const uint64_t* rows, int stride,
+                      int n_rows, int words, int* distances) {
+    if (!hamming_batch_fn) hd_popcount_init();
+    hamming_batch_fn(query, rows, stride, n_rows, words, distances);
+}
@@ -0,0 +1,33 @@
+// hd_popcount.h - XOR + popcount Hamming distance kernels with CPU dispatch
+#ifndef HD_POPCOUNT_H
+#define HD_POPCOUNT_H
+
+#include <stdint.h>
+
+// Available kernel implementations
+typedef enum {
+    HD_POPCOUNT_SCALAR = 0,     // Portable __builtin_popcountll
+    HD_POPCOUNT_POPCNT,         // Hardware POPCNT instruction
+    HD_POPCOUNT_AVX2,           // AVX2 nibble lookup (vpshufb + vpsadbw)
+    HD_POPCOUNT_AVX512,         // AVX-512 VPOPCNTDQ
+    HD_POPCOUNT_BACKEND_COUNT
+} HDPopcountBackend;
+
+// Select the fastest kernel supported by the running CPU.
+// Called by hd_init; the kernels also resolve lazily on first use.
+void hd_popcount_init(void);
+
+// Force a specific kernel (returns 0 if the CPU does not support it)
+int hd_popcount_set_backend(HDPopcountBackend backend);
+HDPopcountBackend hd_popcount_get_backend(void);
+const char* hd_popcount_backend_name(HDPopcountBackend backend);
+
+// Hamming distance between two packed vectors of 'words' 64-bit words
+int hd_hamming_words(const uint64_t* a, const uint64_t* b, int words);
+
+// Hamming distance from one query to each of n_rows packed vectors stored
+// 'stride' words apart, computed in a single pass over the query
+void hd_hamming_batch(const uint64_t* query, const uint64_t* rows, int stride,
+                      int n_rows, int words, int* distances);
+
+#endif // HD_POPCOUNT_H
@@ -0,0 +1,34 @@
+// hd_random.c - Seedable counter-based random numbers for model generation
+#include "hd_random.h"
+#include "hd_vector.h"
+#include <time.h>
+
+// Fill a hypervector with random bits, 64 at a time (tail bits stay zero)
+void hd_random_vector(uint64_t* vector, int dimension, uint64_t seed, uint64_t stream) {
+    uint64_t key = hd_stream_key(seed, stream);
+    int words = HD_WORDS(dimension);
+
+    for (int w = 0; w < words; w++) {
+        vector[w] = hd_random_word(key, (uint64_t)w);
+    }
+    if (words > 0) {
+        vector[words - 1] &= hd_tail_mask(dimension);
+    }
+}
+
+void generate_item_vector(uint64_t* vector, int dimension, uint64_t seed, int index) {
+    hd_random_vector(vector, dimension, seed, HD_STREAM_ITEM | (uint32_t)index);
+}
+
+// Seed 0 asks for a fresh, time-based seed (never 0 itself, so the result
+// can be stored and passed back to reproduce the model)
+uint64_t hd_resolve_seed(uint64_t seed) {
+    if (seed != 0) {
+        return seed;
+    }
+
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    seed = hd_mix64((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+    return seed != 0 ? seed : HD_RANDOM_GAMMA;
+}
@@ -0,0 +1,51 @@
+// hd_random.h - Seedable counter-based random numbers for model generation
+#ifndef HD_RANDOM_H
+#define HD_RANDOM_H
+
+#include <stdint.h>
+
+// Every random word is a pure function of (seed, stream, counter): the
+// SplitMix64 finalizer applied to a Weyl sequence keyed by seed and stream.
+// Any word can be computed on its own, so tables can be generated in any
+// order, on any thread, or regenerated later from the seed alone.
+
+// Streams (the index, e.g. feature or span number, goes in the low 32 bits)
+#define HD_STREAM_ITEM            ((uint64_t)1 << 32)  // Item vector of feature i
+#define HD_STREAM_LEVEL_SPAN      ((uint64_t)2 << 32)  // Level span vector i
+#define HD_STREAM_LEVEL_THRESHOLD ((uint64_t)3 << 32)  // Level interpolation thresholds
+
+#define HD_RANDOM_GAMMA 0x9e3779b97f4a7c15ULL
+
+static inline uint64_t hd_mix64(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Key of one stream under a seed
+static inline uint64_t hd_stream_key(uint64_t seed, uint64_t stream) {
+    return hd_mix64(seed ^ hd_mix64(stream + HD_RANDOM_GAMMA));
+}
+
+// Word 'counter' of a stream
+static inline uint64_t hd_random_word(uint64_t key, uint64_t counter) {
+    return hd_mix64(key + (counter + 1) * HD_RANDOM_GAMMA);
+}
+
+// Word 'word' of item vector 'index' (the same bits generate_item_vector
+// writes, without the tail mask)
+static inline uint64_t hd_item_word(uint64_t seed, int index, int word) {
+    return hd_random_word(hd_stream_key(seed, HD_STREAM_ITEM | (uint32_t)index), (uint64_t)word);
+}
+
+// Uniform float in [0, 1) from the top 24 bits of a word
+static inline float hd_random_unit(uint64_t word) {
+    return (float)(word >> 40) * (1.0f / 16777216.0f);
+}
+
+// Function declarations
+void hd_random_vector(uint64_t* vector, int dimension, uint64_t seed, uint64_t stream);
+void generate_item_vector(uint64_t* vector, int dimension, uint64_t seed, int index);
+uint64_t hd_resolve_seed(uint64_t seed);
+
+#endif // HD_RANDOM_H
@@ -1,18 +1,15 @@
 // hd_similarity.c - Implementation of similarity measures
 #include "hd_similarity.h"
+#include "hd_popcount.h"
+#include "hd_encoder.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include <assert.h>
 
-// Calculate Hamming distance (for binary encoding)
-int compute_hamming_distance(char* vec1, char* vec2, int dimension) {
-    int distance = 0;
-    for (int i = 0; i < dimension; i++) {
-        if (vec1[i] != vec2[i]) {
-            distance++;
-        }
-    }
-    return distance;
+// Calculate Hamming distance (for binary encoding): popcount of the XOR
+int compute_hamming_distance(const uint64_t* vec1, const uint64_t* vec2, int dimension) {
+    return hd_hamming_words(vec1, vec2, HD_WORDS(dimension));
 }
 
 // Compute similarity using Hamming distance
@@ -20,20 +17,32 @@ InferenceResult* compute_similarity(BundledVector* query, ClassVectors* cv) {
     InferenceResult* result = init_inference_result(cv->n_classes);
     if (!result) return NULL;
     
+    finalize_class_vectors(cv);
+    
+    result->predicted_class = classify_encoded_vector(query->final_vector, cv, 
+                                                      result->similarities);
+    return result;
+}
+
+// Classify against all class vectors, scoring every class in one pass
+int classify_encoded_vector(const uint64_t* query, const ClassVectors* cv, int* distances) {
+    int words = HD_WORDS(cv->dimension);
+
+    // Class vectors are binarized lazily after training updates; the entry
+    // points finalize them once before classifying
+    assert(!cv->has_dirty);
+    
     // Use Hamming distance as similarity measure
+    if (distances) {
+        hd_hamming_batch(query, cv->class_hvs, cv->stride, cv->n_classes, words, distances);
+    }
+
     int min_distance = cv->dimension + 1; // Initialize to maximum possible distance
     int predicted_class = -1;
     
     for (int c = 0; c < cv->n_classes; c++) {
-        // Calculate Hamming distance
-        int distance = compute_hamming_distance(
-            query->final_vector,
-            cv->class_hvs[c],
-            cv->dimension
-        );
-        
-        // Store similarity (using negative distance, so higher is better)
-        result->similarities[c] = distance;
+        int distance = distances ? distances[c] 
+                                 : hd_hamming_words(query, class_hv(cv, c), words);
         
         // Update best match (minimum distance)
         if (distance < min_distance) {
@@ -42,19 +51,31 @@ InferenceResult* compute_similarity(BundledVector* query, ClassVectors* cv) {
         }
     }
     
-    result->predicted_class = predicted_class;
-    return result;
+    return predicted_class;
 }
 
 // Evaluate test set
 void evaluate_test_set(Dataset* test_data, ClassVectors* cv,
                       HDLevelVectors* hd, HDMapping* mapping,
-                      char** item_memory, int dimension) {
+                      const uint64_t* item_memory, int dimension) {
     int correct = 0;
     int total = 0;
     int* class_correct = (int*)calloc(cv->n_classes, sizeof(int));
     int* class_total = (int*)calloc(cv->n_classes, sizeof(int));
     
+    int* distances = (int*)malloc(cv->n_classes * sizeof(int));
+    HDEncoder* encoder = init_encoder(hd, mapping, item_memory, test_data->feature_dimension);
+    if (!class_correct || !class_total || !distances || !encoder) {
+        printf("Failed to allocate evaluation buffers\n");
+        free(class_correct);
+        free(class_total);
+        free(distances);
+        free_encoder(encoder);
+        return;
+    }
+    (void)dimension;  // The encoder takes the dimension from the level vectors
+    finalize_class_vectors(cv);
+    
     printf("\nStarting evaluation using Hamming distance...\n");
 
     for (int i = 0; i < test_data->number_of_samples; i++) {
@@ -62,52 +83,41 @@ void evaluate_test_set(Dataset* test_data, ClassVectors* cv,
             printf("Processing test sample %d/%d\n", i, test_data->number_of_samples);
         }
 
-        BundledVector* test_encoded = encode_test_sample(
-            test_data->features[i],
-            hd, mapping, item_memory,
-            test_data->feature_dimension, dimension
-        );
-        
-        if (!test_encoded) continue;
+        // Encode into the encoder's own output vector (no allocation)
+        const uint64_t* test_encoded = encode_features(encoder, dataset_sample(test_data, i), NULL);
 
         // Use Hamming distance
-        InferenceResult* result = compute_similarity(test_encoded, cv);
+        int predicted_class = classify_encoded_vector(test_encoded, cv, distances);
 
-        if (result) {
-            int true_label = test_data->labels[i];
-            class_total[true_label]++;
-            total++;
+        int true_label = test_data->labels[i];
+        class_total[true_label]++;
+        total++;
 
-            if (result->predicted_class == true_label) {
-                correct++;
-                class_correct[true_label]++;
-            }
+        if (predicted_class == true_label) {
+            correct++;
+            class_correct[true_label]++;
+        }
 
-            if (i < 5) {  // Show detailed info for first 5 predictions
-                printf("\nTest sample %d:\n", i);
-                printf("True label: %d, Predicted: %d\n", true_label, result->predicted_class);
-                printf("Hamming distances (lower is better):\n");
-                for (int c = 0; c < cv->n_classes; c++) {
-                    printf("Class %d: %d ", c, result->similarities[c]);
-                    
-                    // Mark the minimum distance (best match)
-                    if (c == result->predicted_class) {
-                        printf("(BEST)");
-                    }
-                    
-                    // Mark the true label
-                    if (c == true_label) {
-                        printf("(TRUE)");
-                    }
-                    
-                    printf("\n");
+        if (i < 5) {  // Show detailed info for first 5 predictions
+            printf("\nTest sample %d:\n", i);
+            printf("True label: %d, Predicted: %d\n", true_label, predicted_class);
+            printf("Hamming distances (lower is better):\n");
+            for (int c = 0; c < cv->n_classes; c++) {
+                printf("Class %d: %d ", c, distances[c]);
+                
+                // Mark the minimum distance (best match)
+                if (c == predicted_class) {
+                    printf("(BEST)");
+                }
+                
+                // Mark the true label
+                if (c == true_label) {
+                    printf("(TRUE)");
                 }
+                
+                printf("\n");
             }
-
-            free_inference_result(result);
         }
-
-        free_bundled_vector(test_encoded);
     }
 
     // Print overall accuracy
@@ -125,4 +135,6 @@ void evaluate_test_set(Dataset* test_data, ClassVectors* cv,
 
     free(class_correct);
     free(class_total);
+    free(distances);
+    free_encoder(encoder);
 }
\ No newline at end of file
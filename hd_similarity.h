@@ -8,12 +8,17 @@
 // Calculate similarity and return prediction result
 InferenceResult* compute_similarity(BundledVector* query, ClassVectors* cv);
 
+// Classify an encoded vector without allocating; distances may be NULL,
+// otherwise it receives n_classes Hamming distances. cv is only read, so
+// threads can share it, and must be finalized (finalize_class_vectors) first.
+int classify_encoded_vector(const uint64_t* query, const ClassVectors* cv, int* distances);
+
 // Evaluate an entire test set
 void evaluate_test_set(Dataset* test_data, ClassVectors* cv, 
                       HDLevelVectors* hd, HDMapping* mapping, 
-                      char** item_memory, int dimension);
+                      const uint64_t* item_memory, int dimension);
 
-// Calculate Hamming distance between binary vectors
-int compute_hamming_distance(char* vec1, char* vec2, int dimension);
+// Calculate Hamming distance between packed binary vectors
+int compute_hamming_distance(const uint64_t* vec1, const uint64_t* vec2, int dimension);
 
 #endif // HD_SIMILARITY_H
\ No newline at end of file
@@ -4,70 +4,73 @@
 #include <stdio.h>
 #include <math.h>
 
-ClassVectors* init_class_vectors(int n_classes, int dimension) {
+// 每個累加器的int數, 補齊到整條 cache line
+static int accumulator_stride(int dimension) {
+    return (int)(arena_footprint(dimension * sizeof(int)) / sizeof(int));
+}
+
+// 類別向量所有資料在 arena 中所佔的位元組數
+size_t class_vectors_bytes(int n_classes, int dimension) {
+    return arena_footprint(n_classes * sizeof(int)) * 2 +
+           arena_footprint((size_t)n_classes * accumulator_stride(dimension) * sizeof(int)) +
+           arena_footprint((size_t)n_classes * HD_ROW_WORDS(dimension) * sizeof(uint64_t));
+}
+
+// arena 為 NULL 時自行建立一個私有 arena
+ClassVectors* init_class_vectors(int n_classes, int dimension, HDArena* arena) {
     ClassVectors* cv = (ClassVectors*)malloc(sizeof(ClassVectors));
     if (!cv) return NULL;
 
     cv->n_classes = n_classes;
     cv->dimension = dimension;
+    cv->stride = HD_ROW_WORDS(dimension);
+    cv->acc_stride = accumulator_stride(dimension);
+    cv->has_dirty = 0;
+    cv->arena = NULL;
 
-    // 分配類別計數器內存
-    cv->class_counts = (int*)calloc(n_classes, sizeof(int));
-    if (!cv->class_counts) {
-        free(cv);
-        return NULL;
-    }
-
-    // 分配累加器內存
-    cv->accumulators = (int**)malloc(n_classes * sizeof(int*));
-    if (!cv->accumulators) {
-        free(cv->class_counts);
-        free(cv);
-        return NULL;
-    }
-
-    // 分配每個類別的累加器內存
-    for (int i = 0; i < n_classes; i++) {
-        cv->accumulators[i] = (int*)calloc(dimension, sizeof(int));
-        if (!cv->accumulators[i]) {
-            for (int j = 0; j < i; j++) {
-                free(cv->accumulators[j]);
-            }
-            free(cv->accumulators);
-            free(cv->class_counts);
+    if (!arena) {
+        cv->arena = init_arena(class_vectors_bytes(n_classes, dimension));
+        if (!cv->arena) {
             free(cv);
             return NULL;
         }
+        arena = cv->arena;
     }
 
-    // 分配類別HV內存
-    cv->class_hvs = (char**)malloc(n_classes * sizeof(char*));
-    if (!cv->class_hvs) {
-        for (int i = 0; i < n_classes; i++) {
-            free(cv->accumulators[i]);
-        }
-        free(cv->accumulators);
-        free(cv->class_counts);
-        free(cv);
+    // 計數器、dirty 旗標、累加器與類別HV 各佔一段連續記憶體 (arena 已清零)
+    cv->class_counts = (int*)arena_alloc(arena, n_classes * sizeof(int));
+    cv->dirty = (int*)arena_alloc(arena, n_classes * sizeof(int));
+    cv->accumulators = (int*)arena_alloc(arena, (size_t)n_classes * cv->acc_stride * sizeof(int));
+    cv->class_hvs = (uint64_t*)arena_alloc(arena, (size_t)n_classes * cv->stride * sizeof(uint64_t));
+    if (!cv->class_counts || !cv->dirty || !cv->accumulators || !cv->class_hvs) {
+        free_class_vectors(cv);
         return NULL;
     }
 
-    // 分配每個類別HV的內存
-    for (int i = 0; i < n_classes; i++) {
-        cv->class_hvs[i] = (char*)malloc(dimension * sizeof(char));
-        if (!cv->class_hvs[i]) {
-            for (int j = 0; j < i; j++) {
-                free(cv->class_hvs[j]);
-            }
-            for (int j = 0; j < n_classes; j++) {
-                free(cv->accumulators[j]);
-            }
-            free(cv->class_hvs);
-            free(cv->accumulators);
-            free(cv->class_counts);
-            free(cv);
-            return NULL;
-        }
+    return cv;
+}
+
+// 以既有的表格 (例如映射進來的模型檔) 建立類別向量, 不複製資料。
+// 只有 dirty 旗標另外配置。
+ClassVectors* wrap_class_vectors(int n_classes, int dimension, int acc_stride, int* class_counts,
+                                 int* accumulators, uint64_t* class_hvs) {
+    ClassVectors* cv = (ClassVectors*)malloc(sizeof(ClassVectors));
+    if (!cv) return NULL;
+
+    cv->n_classes = n_classes;
+    cv->dimension = dimension;
+    cv->stride = HD_ROW_WORDS(dimension);
+    cv->acc_stride = acc_stride;
+    cv->class_counts = class_counts;
+    cv->accumulators = accumulators;
+    cv->class_hvs = class_hvs;
+    cv->has_dirty = 0;
+
+    cv->arena = init_arena(n_classes * sizeof(int));
+    cv->dirty = cv->arena ? (int*)arena_alloc(cv->arena, n_classes * sizeof(int)) : NULL;
+    if (!cv->dirty) {
+        free_class_vectors(cv);
+        return NULL;
     }
 
     return cv;
@@ -75,41 +78,141 @@ ClassVectors* init_class_vectors(int n_classes, int dimension) {
 
 void free_class_vectors(ClassVectors* cv) {
     if (cv) {
-        if (cv->class_counts) free(cv->class_counts);
-        if (cv->accumulators) {
-            for (int i = 0; i < cv->n_classes; i++) {
-                free(cv->accumulators[i]);
-            }
-            free(cv->accumulators);
+        // 資料位於外部 arena 時由 arena 的擁有者釋放
+        free_arena(cv->arena);
+        free(cv);
+    }
+}
+
+void accumulate_training_vector(ClassVectors* cv, int class_label, BundledVector* bundle) {
+    accumulate_encoded_vector(cv, class_label, bundle->final_vector);
+}
+
+// 累加一個已編碼的 packed 向量。
+// 只更新計數器並標記該類別為 dirty; 二值化延遲到 finalize_class_vectors
+// (或第一次查詢時) 才進行, 每個樣本不再需要 O(D) 的重新二值化。
+void accumulate_encoded_vector(ClassVectors* cv, int class_label, const uint64_t* encoded) {
+    add_encoded_vector(cv, class_label, encoded);
+}
+
+// 將 packed 向量的每個位元乘上 delta (+1 或 -1) 加到累加器。
+// 以整個 word 為單位展開, 內層迴圈沒有分支, 編譯器可以向量化。
+static void update_accumulator(int* acc, const uint64_t* encoded, int dimension, int delta) {
+    int full_words = dimension / HD_WORD_BITS;
+
+    for (int w = 0; w < full_words; w++) {
+        uint64_t word = encoded[w];
+        int* block = acc + w * HD_WORD_BITS;
+        for (int b = 0; b < HD_WORD_BITS; b++) {
+            block[b] += delta * (int)((word >> b) & 1);
         }
-        if (cv->class_hvs) {
-            for (int i = 0; i < cv->n_classes; i++) {
-                free(cv->class_hvs[i]);
+    }
+    for (int i = full_words * HD_WORD_BITS; i < dimension; i++) {
+        acc[i] += delta * hd_get_bit(encoded, i);
+    }
+}
+
+// 只更新累加器與樣本數, 並標記該類別需要重新二值化
+void add_encoded_vector(ClassVectors* cv, int class_label, const uint64_t* encoded) {
+    if (class_label < 0 || class_label >= cv->n_classes) return;
+
+    update_accumulator(class_accumulator(cv, class_label), encoded, cv->dimension, 1);
+    cv->class_counts[class_label]++;
+    cv->dirty[class_label] = 1;
+    cv->has_dirty = 1;
+}
+
+// add_encoded_vector 的反向操作: 從類別中移除一個樣本的貢獻
+void subtract_encoded_vector(ClassVectors* cv, int class_label, const uint64_t* encoded) {
+    if (class_label < 0 || class_label >= cv->n_classes) return;
+
+    update_accumulator(class_accumulator(cv, class_label), encoded, cv->dimension, -1);
+    cv->class_counts[class_label]--;
+    cv->dirty[class_label] = 1;
+    cv->has_dirty = 1;
+}
+
+// 重新訓練 (perceptron 式修正): 被誤判的樣本加到正確類別、從誤判類別扣除,
+// 並只重新二值化這兩個類別
+void correct_encoded_vector(ClassVectors* cv, int true_class, int predicted_class,
+                            const uint64_t* encoded) {
+    if (true_class == predicted_class) return;
+    if (true_class < 0 || true_class >= cv->n_classes) return;
+    if (predicted_class < 0 || predicted_class >= cv->n_classes) return;
+
+    add_encoded_vector(cv, true_class, encoded);
+    subtract_encoded_vector(cv, predicted_class, encoded);
+    refresh_class_vector(cv, true_class);
+    refresh_class_vector(cv, predicted_class);
+}
+
+// 線上學習: 累加一個樣本後立即只重新二值化該類別,
+// 其他類別不受影響, 每次更新的成本固定為 O(D)
+void learn_encoded_vector(ClassVectors* cv, int class_label, const uint64_t* encoded) {
+    if (class_label < 0 || class_label >= cv->n_classes) return;
+
+    add_encoded_vector(cv, class_label, encoded);
+    refresh_class_vector(cv, class_label);
+}
+
+// 將各執行緒私有的累加器加總到 dst 的 [dim_begin, dim_end) 區段。
+// 每個執行緒負責不同的維度區段, 因此合併時不需要任何鎖。
+void merge_class_accumulators(ClassVectors* dst, ClassVectors** parts, int n_parts,
+                              int dim_begin, int dim_end) {
+    for (int p = 0; p < n_parts; p++) {
+        if (parts[p] == dst) continue;
+        for (int c = 0; c < dst->n_classes; c++) {
+            int* to = class_accumulator(dst, c);
+            const int* from = class_accumulator(parts[p], c);
+            for (int i = dim_begin; i < dim_end; i++) {
+                to[i] += from[i];
             }
-            free(cv->class_hvs);
         }
-        free(cv);
     }
 }
 
-void accumulate_training_vector(ClassVectors* cv, int class_label, BundledVector* bundle) {
-    if (class_label >= 0 && class_label < cv->n_classes) {
-        // 累加
-        for (int i = 0; i < cv->dimension; i++) {
-            cv->accumulators[class_label][i] += bundle->final_vector[i];
+// 依累加結果二值化單一類別: 大於類別樣本數量一半的為1，否則為0
+void refresh_class_vector(ClassVectors* cv, int class_label) {
+    const int* acc = class_accumulator(cv, class_label);
+    uint64_t* hv = class_hv(cv, class_label);
+    int threshold = cv->class_counts[class_label] / 2;
+    int words = HD_WORDS(cv->dimension);
+
+    for (int w = 0; w < words; w++) {
+        int base = w * HD_WORD_BITS;
+        int bits = cv->dimension - base < HD_WORD_BITS ? cv->dimension - base : HD_WORD_BITS;
+        uint64_t packed = 0;
+        for (int b = 0; b < bits; b++) {
+            packed |= (uint64_t)(acc[base + b] > threshold) << b;
         }
-        cv->class_counts[class_label]++;
-        
-        // 二值化: 大於等於類別樣本數量一半的為1，否則為0
-        int threshold = cv->class_counts[class_label] / 2;
-        for (int i = 0; i < cv->dimension; i++) {
-            cv->class_hvs[class_label][i] = (cv->accumulators[class_label][i] > threshold) ? 1 : 0;
+        hv[w] = packed;
+    }
+    cv->dirty[class_label] = 0;
+}
+
+// 依目前的累加結果重新二值化所有類別向量
+void binarize_class_vectors(ClassVectors* cv) {
+    for (int c = 0; c < cv->n_classes; c++) {
+        refresh_class_vector(cv, c);
+    }
+    cv->has_dirty = 0;
+}
+
+// 只重新二值化有更新過的類別
+void finalize_class_vectors(ClassVectors* cv) {
+    if (!cv->has_dirty) return;
+
+    for (int c = 0; c < cv->n_classes; c++) {
+        if (cv->dirty[c]) {
+            refresh_class_vector(cv, c);
         }
     }
+    cv->has_dirty = 0;
 }
 
 // 修改統計信息顯示函數
 void print_class_vector_stats(ClassVectors* cv) {
+    finalize_class_vectors(cv);
     printf("\n類別向量統計:\n");
     for (int c = 0; c < cv->n_classes; c++) {
         printf("類別 %d:\n", c);
@@ -117,12 +220,7 @@ void print_class_vector_stats(ClassVectors* cv) {
         
         if (cv->class_counts[c] > 0) {
             // 計算1的比例
-            int ones_count = 0;
-            for (int i = 0; i < cv->dimension; i++) {
-                if (cv->class_hvs[c][i] == 1) {
-                    ones_count++;
-                }
-            }
+            int ones_count = count_ones(class_hv(cv, c), cv->dimension);
             
             double ones_ratio = (double)ones_count / cv->dimension * 100;
             printf("  1的比例: %.2f%%\n", ones_ratio);
@@ -130,7 +228,7 @@ void print_class_vector_stats(ClassVectors* cv) {
             // 打印前10個位元值
             printf("  前10個位元值: ");
             for (int i = 0; i < 10; i++) {
-                printf("%d ", cv->class_hvs[c][i]);
+                printf("%d ", hd_get_bit(class_hv(cv, c), i));
             }
             printf("\n");
         }
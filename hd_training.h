@@ -2,21 +2,51 @@
 #define HD_TRAINING_H
 
 #include "hd_bundling.h"
+#include "hd_arena.h"
 #include "mnist_loader.h"
 
 // 存儲類別向量的結構
 typedef struct {
     int n_classes;        // 類別數量
     int dimension;        // 向量維度
+    int stride;           // 相鄰類別HV間隔的word數
+    int acc_stride;       // 相鄰累加器間隔的int數
     int *class_counts;    // 每個類別的樣本數量
-    int **accumulators;   // 存儲每個類別的累加結果
-    char **class_hvs;     // 最終的類別超維向量
+    int *accumulators;    // 存儲每個類別的累加結果, 連續存放
+    uint64_t *class_hvs;  // 最終的類別超維向量, 連續存放 (packed)
+    int *dirty;           // 累加器已更新但尚未重新二值化的類別
+    int has_dirty;        // 是否有任何類別需要重新二值化
+    HDArena *arena;       // 私有 arena (NULL 表示資料位於外部 arena)
 } ClassVectors;
 
+// 取得類別 c 的超維向量
+static inline uint64_t* class_hv(const ClassVectors* cv, int c) {
+    return hd_row(cv->class_hvs, cv->stride, c);
+}
+
+// 取得類別 c 的累加器
+static inline int* class_accumulator(const ClassVectors* cv, int c) {
+    return cv->accumulators + (size_t)c * cv->acc_stride;
+}
+
 // 函數聲明
-ClassVectors* init_class_vectors(int n_classes, int dimension);
+size_t class_vectors_bytes(int n_classes, int dimension);
+ClassVectors* init_class_vectors(int n_classes, int dimension, HDArena* arena);
+ClassVectors* wrap_class_vectors(int n_classes, int dimension, int acc_stride, int* class_counts,
+                                 int* accumulators, uint64_t* class_hvs);
 void free_class_vectors(ClassVectors* cv);
 void accumulate_training_vector(ClassVectors* cv, int class_label, BundledVector* bundle);
+void accumulate_encoded_vector(ClassVectors* cv, int class_label, const uint64_t* encoded);
+void add_encoded_vector(ClassVectors* cv, int class_label, const uint64_t* encoded);
+void learn_encoded_vector(ClassVectors* cv, int class_label, const uint64_t* encoded);
+void subtract_encoded_vector(ClassVectors* cv, int class_label, const uint64_t* encoded);
+void correct_encoded_vector(ClassVectors* cv, int true_class, int predicted_class,
+                            const uint64_t* encoded);
+void merge_class_accumulators(ClassVectors* dst, ClassVectors** parts, int n_parts,
+                              int dim_begin, int dim_end);
+void binarize_class_vectors(ClassVectors* cv);
+void finalize_class_vectors(ClassVectors* cv);
+void refresh_class_vector(ClassVectors* cv, int class_label);
 void quantize_class_vectors(ClassVectors* cv, int bits);
 void print_class_vector_stats(ClassVectors* cv);
 
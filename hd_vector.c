@@ -0,0 +1,53 @@
+// hd_vector.c - Implementation of packed hypervector helpers
+#include "hd_vector.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Allocate a zeroed hypervector
+uint64_t* alloc_hypervector(int dimension) {
+    return (uint64_t*)calloc(HD_WORDS(dimension), sizeof(uint64_t));
+}
+
+void free_hypervector(uint64_t* vector) {
+    free(vector);
+}
+
+// Mask of the valid bits in the last word of a vector
+uint64_t hd_tail_mask(int dimension) {
+    int used = dimension % HD_WORD_BITS;
+    return used ? (((uint64_t)1 << used) - 1) : ~(uint64_t)0;
+}
+
+void clear_hypervector(uint64_t* vector, int dimension) {
+    memset(vector, 0, HD_WORDS(dimension) * sizeof(uint64_t));
+}
+
+void copy_hypervector(uint64_t* dst, const uint64_t* src, int dimension) {
+    memcpy(dst, src, HD_WORDS(dimension) * sizeof(uint64_t));
+}
+
+// Binding of two packed vectors (XOR), one word at a time
+void xor_hypervectors(const uint64_t* a, const uint64_t* b, uint64_t* result, int dimension) {
+    int words = HD_WORDS(dimension);
+    for (int w = 0; w < words; w++) {
+        result[w] = a[w] ^ b[w];
+    }
+}
+
+// Number of elements set to 1
+int count_ones(const uint64_t* vector, int dimension) {
+    int words = HD_WORDS(dimension);
+    int ones = 0;
+    for (int w = 0; w < words; w++) {
+        ones += __builtin_popcountll(vector[w]);
+    }
+    return ones;
+}
+
+// Serialize to bytes, element i at bit (i % 8) of byte i / 8
+void hypervector_to_bytes(const uint64_t* vector, uint8_t* packed, int dimension) {
+    int n_bytes = dimension / 8 + (dimension % 8 ? 1 : 0);
+    for (int j = 0; j < n_bytes; j++) {
+        packed[j] = (uint8_t)(vector[j / 8] >> (8 * (j % 8)));
+    }
+}
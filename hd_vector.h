@@ -0,0 +1,50 @@
+// hd_vector.h - Packed binary hypervector storage
+#ifndef HD_VECTOR_H
+#define HD_VECTOR_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Hypervectors are stored as packed bits in 64-bit words: element i lives in
+// word i / 64 at bit position i % 64. Bits past the dimension in the last word
+// are always kept at zero so that XOR/popcount over whole words is exact.
+#define HD_WORD_BITS 64
+#define HD_WORDS(dimension) (((dimension) + HD_WORD_BITS - 1) / HD_WORD_BITS)
+
+// Tables of hypervectors are stored row after row in one block. Each row is
+// padded to whole cache lines so every row starts 64-byte aligned.
+#define HD_ALIGNMENT 64
+#define HD_ROW_WORDS(dimension) \
+    ((HD_WORDS(dimension) + HD_ALIGNMENT / 8 - 1) / (HD_ALIGNMENT / 8) * (HD_ALIGNMENT / 8))
+
+// Row 'index' of a table whose rows are 'stride' words apart
+static inline uint64_t* hd_row(const uint64_t* table, int stride, int index) {
+    return (uint64_t*)(table + (size_t)index * stride);
+}
+
+// Read a single element (0 or 1)
+static inline int hd_get_bit(const uint64_t* vector, int index) {
+    return (int)((vector[index / HD_WORD_BITS] >> (index % HD_WORD_BITS)) & 1u);
+}
+
+// Write a single element (0 or 1)
+static inline void hd_set_bit(uint64_t* vector, int index, int value) {
+    uint64_t mask = (uint64_t)1 << (index % HD_WORD_BITS);
+    if (value) {
+        vector[index / HD_WORD_BITS] |= mask;
+    } else {
+        vector[index / HD_WORD_BITS] &= ~mask;
+    }
+}
+
+// Function declarations
+uint64_t* alloc_hypervector(int dimension);
+void free_hypervector(uint64_t* vector);
+uint64_t hd_tail_mask(int dimension);
+void clear_hypervector(uint64_t* vector, int dimension);
+void copy_hypervector(uint64_t* dst, const uint64_t* src, int dimension);
+void xor_hypervectors(const uint64_t* a, const uint64_t* b, uint64_t* result, int dimension);
+int count_ones(const uint64_t* vector, int dimension);
+void hypervector_to_bytes(const uint64_t* vector, uint8_t* packed, int dimension);
+
+#endif // HD_VECTOR_H
@@ -44,7 +44,11 @@ int main(int argc, char* argv[]) {
     printf("Configuration:\n");
     printf("- HD Dimension: %d\n", HD_DIMENSION);
     printf("- Levels: %d\n", HD_LEVEL_COUNT);
+    if (HD_SEED != 0) {
+        printf("- Seed: %llu\n", (unsigned long long)HD_SEED);
+    }
     printf("- Encoding: Binary (0,1)\n");
+    printf("- Threads: %d\n", hd_default_thread_count());
     
     // Dataset-specific information
     int feature_dimension = 0;
@@ -153,6 +157,13 @@ int main(int argc, char* argv[]) {
         return 1;
     }
     
+    if (HD_RETRAIN_EPOCHS > 0 && !hd_retrain(hd_context, train_data, HD_RETRAIN_EPOCHS)) {
+        printf("Retraining failed\n");
+        hd_free(hd_context);
+        free_dataset(train_data);
+        return 1;
+    }
+    
     // Load test data
     printf("\nLoading %s test data...\n", dataset_name);
     Dataset* test_data = load_dataset(dataset_type, "test");
@@ -179,6 +190,12 @@ int main(int argc, char* argv[]) {
         printf("Failed to save model\n");
     }
     
+    // Binary model that hd_load_model can map without retraining
+    sprintf(model_filename, "./output/%s_model.bin", dataset_name);
+    if (!hd_save_model_binary(hd_context, model_filename)) {
+        printf("Failed to save binary model\n");
+    }
+    
     // Clean up resources
     printf("\nCleaning up resources...\n");
     hd_free(hd_context);
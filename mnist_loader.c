@@ -5,6 +5,12 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <sys/mman.h>
+
+#define IDX_IMAGE_MAGIC 2051    // unsigned byte, 3 dimensions
+#define IDX_LABEL_MAGIC 2049    // unsigned byte, 1 dimension
+#define IDX_IMAGE_HEADER_SIZE 16
+#define IDX_LABEL_HEADER_SIZE 8
 
 // Function to swap endianness (MNIST files are big-endian)
 static uint32_t swap_endian(uint32_t value) {
@@ -14,123 +20,210 @@ static uint32_t swap_endian(uint32_t value) {
            ((value & 0x000000FF) << 24);
 }
 
-// Load MNIST dataset
-Dataset* load_mnist_dataset(const char* image_path, const char* label_path) {
-    FILE *image_file, *label_file;
-    Dataset* dataset;
-    uint32_t magic_number, num_images, num_rows, num_cols;
-    uint32_t label_magic_number, num_labels;
-    
-    // Allocate dataset structure
-    dataset = (Dataset*)malloc(sizeof(Dataset));
-    if (!dataset) {
-        printf("Failed to allocate memory for dataset\n");
+// Read the index-th big-endian header field of a mapped IDX file
+static uint32_t idx_header_field(const unsigned char* base, int index) {
+    uint32_t value;
+    memcpy(&value, base + index * sizeof(uint32_t), sizeof(uint32_t));
+    return swap_endian(value);
+}
+
+// Load an IDX image/label pair. Both files are memory-mapped and the pixel
+// block is used in place as a contiguous feature matrix, so nothing is copied.
+Dataset* load_idx_dataset(const char* image_path, const char* label_path,
+                          const char* name, int num_classes) {
+    size_t image_size, label_size;
+
+    unsigned char* image_base = (unsigned char*)map_file_readonly(image_path, &image_size);
+    if (!image_base) {
+        printf("Failed to open image file: %s\n", image_path);
         return NULL;
     }
-    
-    // Set dataset information
-    strncpy(dataset->name, "MNIST", sizeof(dataset->name)-1);
-    dataset->original_feature_type = 0; // 8-bit
 
-    // Open image file
-    image_file = fopen(image_path, "rb");
-    if (!image_file) {
-        printf("Failed to open image file: %s\n", image_path);
-        free(dataset);
+    if (image_size < IDX_IMAGE_HEADER_SIZE ||
+        idx_header_field(image_base, 0) != IDX_IMAGE_MAGIC) {
+        printf("Invalid magic number in image file: %s\n", image_path);
+        munmap(image_base, image_size);
         return NULL;
     }
 
-    // Read image file header
-    fread(&magic_number, sizeof(uint32_t), 1, image_file);
-    fread(&num_images, sizeof(uint32_t), 1, image_file);
-    fread(&num_rows, sizeof(uint32_t), 1, image_file);
-    fread(&num_cols, sizeof(uint32_t), 1, image_file);
+    uint32_t num_images = idx_header_field(image_base, 1);
+    uint32_t num_rows = idx_header_field(image_base, 2);
+    uint32_t num_cols = idx_header_field(image_base, 3);
+    size_t pixels = (size_t)num_rows * num_cols;
 
-    // Convert endianness
-    magic_number = swap_endian(magic_number);
-    num_images = swap_endian(num_images);
-    num_rows = swap_endian(num_rows);
-    num_cols = swap_endian(num_cols);
+    if (pixels == 0 || (image_size - IDX_IMAGE_HEADER_SIZE) / pixels < num_images) {
+        printf("Image file is truncated: %s\n", image_path);
+        munmap(image_base, image_size);
+        return NULL;
+    }
 
-    // Open label file
-    label_file = fopen(label_path, "rb");
-    if (!label_file) {
+    unsigned char* label_base = (unsigned char*)map_file_readonly(label_path, &label_size);
+    if (!label_base) {
         printf("Failed to open label file: %s\n", label_path);
-        fclose(image_file);
-        free(dataset);
+        munmap(image_base, image_size);
         return NULL;
     }
 
-    // Read label file header
-    fread(&label_magic_number, sizeof(uint32_t), 1, label_file);
-    fread(&num_labels, sizeof(uint32_t), 1, label_file);
-    
-    label_magic_number = swap_endian(label_magic_number);
-    num_labels = swap_endian(num_labels);
+    if (label_size < IDX_LABEL_HEADER_SIZE ||
+        idx_header_field(label_base, 0) != IDX_LABEL_MAGIC) {
+        printf("Invalid magic number in label file: %s\n", label_path);
+        munmap(label_base, label_size);
+        munmap(image_base, image_size);
+        return NULL;
+    }
+
+    uint32_t num_labels = idx_header_field(label_base, 1);
 
     // Verify that image and label counts match
-    if (num_images != num_labels) {
-        printf("Image count (%d) and label count (%d) do not match\n", num_images, num_labels);
-        fclose(image_file);
-        fclose(label_file);
-        free(dataset);
+    if (num_images != num_labels || label_size - IDX_LABEL_HEADER_SIZE < num_labels) {
+        printf("Image count (%u) and label count (%u) do not match\n", num_images, num_labels);
+        munmap(label_base, label_size);
+        munmap(image_base, image_size);
         return NULL;
     }
 
-    // Set dataset properties
-    dataset->number_of_samples = num_images;
-    dataset->feature_dimension = num_rows * num_cols;
-    dataset->num_classes = MNIST_NUM_CLASSES;
-
-    // Allocate memory for features and read data
-    dataset->features = (unsigned char**)malloc(num_images * sizeof(unsigned char*));
-    if (!dataset->features) {
-        printf("Failed to allocate memory for features\n");
-        fclose(image_file);
-        fclose(label_file);
-        free(dataset);
+    Dataset* dataset = (Dataset*)calloc(1, sizeof(Dataset));
+    if (!dataset) {
+        printf("Failed to allocate memory for dataset\n");
+        munmap(label_base, label_size);
+        munmap(image_base, image_size);
         return NULL;
     }
 
-    for (uint32_t  i = 0; i < num_images; i++) {
-        dataset->features[i] = (unsigned char*)malloc(num_rows * num_cols);
-        if (!dataset->features[i]) {
-            printf("Failed to allocate memory for image %d\n", i);
-            // Free previously allocated memory
-            for (uint32_t  j = 0; j < i; j++) {
-                free(dataset->features[j]);
-            }
-            free(dataset->features);
-            fclose(image_file);
-            fclose(label_file);
-            free(dataset);
-            return NULL;
-        }
-        // Read image data
-        fread(dataset->features[i], 1, num_rows * num_cols, image_file);
+    // Set dataset information
+    strncpy(dataset->name, name, sizeof(dataset->name)-1);
+    dataset->original_feature_type = 0; // 8-bit
+    dataset->number_of_samples = num_images;
+    dataset->feature_dimension = (int)pixels;
+    dataset->num_classes = num_classes;
+
+    // The mapped files now belong to the dataset
+    dataset->mapped_features = image_base;
+    dataset->mapped_features_size = image_size;
+    dataset->mapped_labels = label_base;
+    dataset->mapped_labels_size = label_size;
+    dataset->feature_data = image_base + IDX_IMAGE_HEADER_SIZE;
+    dataset->feature_stride = (int)pixels;
+    dataset->labels = label_base + IDX_LABEL_HEADER_SIZE;
+
+    return dataset;
+}
+
+// Sequential reader over an IDX image/label pair
+typedef struct {
+    FILE* image_file;
+    FILE* label_file;
+    int feature_dimension;
+    uint32_t remaining;       // Samples not read yet
+} IDXStreamState;
+
+static void close_idx_stream(void* state) {
+    IDXStreamState* idx = (IDXStreamState*)state;
+    if (idx) {
+        if (idx->image_file) fclose(idx->image_file);
+        if (idx->label_file) fclose(idx->label_file);
+        free(idx);
     }
+}
 
-    // Read label data
-    dataset->labels = (unsigned char*)malloc(num_images);
-    if (!dataset->labels) {
-        printf("Failed to allocate memory for labels\n");
-        for (uint32_t  i = 0; i < num_images; i++) {
-            free(dataset->features[i]);
+static int next_idx_batch(void* state, DatasetBatch* batch) {
+    IDXStreamState* idx = (IDXStreamState*)state;
+    int n = idx->remaining < (uint32_t)batch->capacity ? (int)idx->remaining : batch->capacity;
+    
+    for (int i = 0; i < n; i++) {
+        if (fread(batch_sample(batch, i), 1, idx->feature_dimension, idx->image_file) != 
+            (size_t)idx->feature_dimension) {
+            printf("Image file ended early\n");
+            return -1;
         }
-        free(dataset->features);
-        fclose(image_file);
-        fclose(label_file);
-        free(dataset);
-        return NULL;
     }
-    fread(dataset->labels, 1, num_images, label_file);
+    if (fread(batch->labels, 1, n, idx->label_file) != (size_t)n) {
+        printf("Label file ended early\n");
+        return -1;
+    }
+    
+    idx->remaining -= n;
+    return n;
+}
 
-    // Close files
-    fclose(image_file);
-    fclose(label_file);
+// Open an IDX image/label pair for streaming. Only the headers are read
+// here; samples are read batch by batch, so the files may exceed memory.
+DatasetStream* open_idx_stream(const char* image_path, const char* label_path,
+                               const char* name, int num_classes) {
+    unsigned char image_header[IDX_IMAGE_HEADER_SIZE];
+    unsigned char label_header[IDX_LABEL_HEADER_SIZE];
     
-    printf("Loaded MNIST dataset: %d samples, %d features, %d classes\n", 
-           dataset->number_of_samples, dataset->feature_dimension, dataset->num_classes);
+    IDXStreamState* idx = (IDXStreamState*)calloc(1, sizeof(IDXStreamState));
+    if (!idx) {
+        printf("Failed to allocate memory for IDX stream\n");
+        return NULL;
+    }
+    
+    idx->image_file = fopen(image_path, "rb");
+    if (!idx->image_file) {
+        printf("Failed to open image file: %s\n", image_path);
+        close_idx_stream(idx);
+        return NULL;
+    }
+    
+    idx->label_file = fopen(label_path, "rb");
+    if (!idx->label_file) {
+        printf("Failed to open label file: %s\n", label_path);
+        close_idx_stream(idx);
+        return NULL;
+    }
+    
+    if (fread(image_header, 1, sizeof(image_header), idx->image_file) != sizeof(image_header) ||
+        idx_header_field(image_header, 0) != IDX_IMAGE_MAGIC) {
+        printf("Invalid magic number in image file: %s\n", image_path);
+        close_idx_stream(idx);
+        return NULL;
+    }
+    
+    if (fread(label_header, 1, sizeof(label_header), idx->label_file) != sizeof(label_header) ||
+        idx_header_field(label_header, 0) != IDX_LABEL_MAGIC) {
+        printf("Invalid magic number in label file: %s\n", label_path);
+        close_idx_stream(idx);
+        return NULL;
+    }
+    
+    uint32_t num_images = idx_header_field(image_header, 1);
+    uint32_t num_labels = idx_header_field(label_header, 1);
+    size_t pixels = (size_t)idx_header_field(image_header, 2) * idx_header_field(image_header, 3);
     
+    if (pixels == 0 || pixels > INT32_MAX) {
+        printf("Invalid image size in image file: %s\n", image_path);
+        close_idx_stream(idx);
+        return NULL;
+    }
+    
+    // Verify that image and label counts match
+    if (num_images != num_labels) {
+        printf("Image count (%u) and label count (%u) do not match\n", num_images, num_labels);
+        close_idx_stream(idx);
+        return NULL;
+    }
+    
+    idx->feature_dimension = (int)pixels;
+    idx->remaining = num_images;
+    
+    DatasetStream* stream = init_dataset_stream(name, (int)pixels, num_classes, 
+                                                next_idx_batch, close_idx_stream, idx);
+    if (!stream) {
+        close_idx_stream(idx);
+    }
+    return stream;
+}
+
+// Load MNIST dataset
+Dataset* load_mnist_dataset(const char* image_path, const char* label_path) {
+    Dataset* dataset = load_idx_dataset(image_path, label_path, "MNIST", MNIST_NUM_CLASSES);
+    if (!dataset) {
+        return NULL;
+    }
+
+    printf("Loaded MNIST dataset: %d samples, %d features, %d classes\n",
+           dataset->number_of_samples, dataset->feature_dimension, dataset->num_classes);
+
     return dataset;
-}
\ No newline at end of file
+}
@@ -0,0 +1,68 @@
+#ifndef PACKED_VECTORS_H
+#define PACKED_VECTORS_H
+
+#include <stdint.h>
+
+#define HD_DIMENSION 2000
+#define PACKED_DIMENSION 250
+#define FEATURE_DIMENSION 42
+#define NUM_CLASSES 3
+#define DATASET_NAME "CONNECT4"
+
+const uint8_t packed_item_memory[42][250] = {
+    {0x94,0x80,0x75,0x5B,0xE1,0xC7,0x30,0x32,0xD1,0xCD,0xAE,0x34,0x3B,0xF2,0x40,0xB8,0x48,0x43,0x46,0x43,0x36,0xFA,0x79,0x5A,0x6B,0x3C,0x35,0x16,0xBD,0x63,0x79,0x48,0xE6,0x5D,0x95,0xE8,0xC4,0x1A,0x2E,0x54,0x99,0x65,0xF4,0x79,0x3E,0x87,0xDC,0x23,0x86,0xD7,0x1C,0x19,0x9B,0x4C,0xCC,0x12,0x0C,0x32,0x3F,0x90,0x60,0x82,0xCB,0xBE,0x4F,0x9B,0xE0,0xA8,0x86,0xBE,0xF0,0xD0,0xF4,0x60,0x9B,0x9E,0xE7,0x4F,0x2C,0x76,0xE2,0xDD,0x00,0x43,0x1F,0x67,0x3F,0xA9,0x33,0x62,0x7C,0x10,0x51,0xB2,0xDD,0x12,0x96,0x81,0x52,0x5B,0x09,0x90,0x6D,0x96,0x49,0x65,0x07,0x53,0xE2,0x15,0x1B,0xD9,0x3B,0x83,0xB7,0x33,0x11,0xD2,0x9D,0x35,0xB1,0x1C,0xE5,0x6F,0xB8,0x73,0x8D,0x03,0xBC,0x14,0xAF,0xFE,0x8A,0xA4,0x39,0x9C,0x65,0x71,0x95,0xCA,0x94,0x86,0x0C,0x4D,0xF0,0xC4,0x20,0x07,0x63,0xF3,0x27,0xC2,0x5F,0x63,0x59,0xAB,0x87,0xA2,0x4C,0x54,0xF9,0x06,0xFA,0x6D,0xD5,0xB7,0xE0,0x82,0x28,0xDA,0xBF,0xD6,0x92,0x15,0x67,0x9A,0x05,0x5A,0x44,0xD3,0xFF,0x0C,0xDF,0xAF,0x9A,0xE6,0xA8,0x99,0x08,0x46,0xC2,0x08,0x9D,0x97,0xDD,0xEE,0x1A,0x73,0x95,0x42,0xA7,0xEA,0x9A,0x1F,0xD2,0xDF,0x1B,0x25,0x51,0x71,0xCE,0xC0,0x97,0xB5,0x20,0xE0,0xC5,0x46,0xB4,0xCD,0xAC,0x04,0xC2,0x56,0x2E,0x5B,0x32,0x92,0x4B,0xFF,0x82,0xE5,0x20,0xD4,0x3F,0x02,0x24,0x13,0xDB,0x64,0xB0,0x36,0xF5,0x4D,0xC2,0xE5,0x1C,0x06,0x70,0x44},
+    {0x24,0x64,0xDE,0xCD,0xB4,0xB3,0xAA,0xF2,0xC5,0xC7,0xBB,0x74,0x5B,0x45,0x8E,0x06,0x57,0x69,0xBF,0xCF,0x33,0xAB,0x7E,0xAD,0x1C,0x59,0x15,0xDD,0x80,0x04,0xAA,0x73,0x02,0xDB,0x50,0xFA,0xE6,0x0A,0xFA,0x0E,0x54,0xDF,0xA3,0xF2,0x85,0xCC,0xF6,0x70,0xBB,0x0F,0x93,0x7C,0xEE,0xC9,0x9A,0xF8,0x79,0x4F,0xFE,0x73,0xD5,0xB0,0x2A,0x11,0x0E,0x8A,0xEB,0x6D,0xCD,0x3B,0xA6,0x5B,0x8C,0xB5,0x82,0xA1,0x12,0xC2,0xB6,0x44,0x5B,0x61,0x65,0x5B,0x6D,0xAB,0xEB,0x8C,0xEA,0xAE,0x44,0x90,0x61,0x94,0x76,0x13,0x49,0xF6,0xEA,0xC8,0x40,0xD1,0x0B,0xA4,0xCD,0xAC,0xDA,0xAF,0xA0,0xAB,0x38,0xD6,0x76,0x99,0x01,0xD7,0xEA,0xE7,0xB6,0x66,0x16,0x46,0xB8,0xB4,0x2E,0xFA,0xF5,0x43,0x82,0x31,0x23,0x40,0x1B,0xC8,0x93,0xE0,0x6E,0xE2,0xF7,0x22,0x46,0xC2,0x2F,0x7C,0xF2,0xBE,0xD0,0x91,0x87,0x0A,0x5C,0x3A,0x66,0x4E,0x68,0xB4,0xEF,0xE0,0x42,0xA8,0xAA,0xD5,0xBB,0x19,0xF4,0x97,0x19,0x93,0xE3,0x40,0xEE,0xC6,0xF7,0x97,0xC2,0x0D,0x38,0x01,0x61,0x04,0xCC,0x64,0xB2,0x0D,0xD6,0x6A,0xAE,0x49,0xDC,0x23,0x52,0x60,0x28,0x82,0xFC,0xBB,0xD9,0x67,0x1C,0x18,0x28,0x6B,0x4D,0xB6,0x81,0x31,0x2D,0x72,0x09,0x18,0xC2,0x47,0x4E,0x12,0x61,0xE9,0xFB,0xDE,0x5C,0x72,0x4E,0xA8,0xFB,0xFA,0x9D,0xB8,0xF0,0x57,0xE5,0x8B,0x1C,0xCA,0x8C,0x41,0x24,0x9F,0x1B,0x32,0x13,0xA5,0xF8,0xD8,0xEE,0xD1,0xF8,0x9B,0x6B,0xF3,0x57,0xA5},
+    {0xCC,0x63,0x81,0x50,0x84,0x7D,0x61,0x33,0x12,0x22,0xEB,0x97,0x7F,0x5B,0x3B,0xE1,0xC8,0xC3,0xA7,0x4F,0xBF,0x04,0x63,0x16,0xAE,0x24,0x6A,0x90,0xF1,0x49,0xDF,0xD7,0xCE,0xD6,0x18,0x29,0x9E,0x2B,0x25,0x7D,0xBE,0xD9,0xDC,0x90,0xC3,0x73,0x9F,0xAC,0xA8,0x23,0xFE,0x41,0x1E,0x69,0xF0,0x8D,0x5A,0xEB,0x0E,0x2E,0xC5,0x43,0x81,0x12,0x32,0x68,0x43,0x93,0xA7,0x22,0x69,0x3A,0xD2,0x17,0xDC,0x03,0x45,0xDA,0xA8,0xAD,0xFB,0xFA,0x1B,0xA6,0x54,0xDC,0x6A,0x2C,0x03,0x0C,0x06,0xCF,0x49,0xDE,0x5F,0x77,0x6B,0xE4,0x1A,0x83,0x29,0x02,0x81,0x57,0xD0,0x13,0x28,0x68,0x9F,0xED,0x90,0xE0,0xE1,0x41,0x3A,0x79,0x4F,0xFB,0x4A,0x94,0xA2,0xB1,0xDC,0xD4,0x1F,0x50,0xD5,0x1E,0x48,0x83,0x5E,0xD5,0x32,0xF6,0x15,0x0C,0x51,0x11,0xBE,0x7F,0xEA,0x49,0xC1,0x05,0xE4,0x5B,0x12,0x92,0x3D,0x96,0x9A,0x11,0xEE,0xFC,0x5A,0x13,0xE6,0x61,0xE8,0x6C,0x8E,0x69,0x63,0xA3,0x82,0xF0,0x0F,0x51,0xD2,0xE2,0x24,0xB1,0x1E,0xF9,0x59,0x63,0xCC,0xE2,0x87,0x46,0xE4,0x1E,0x66,0x20,0xF0,0xB8,0x86,0x06,0x9C,0x67,0x64,0xDA,0x18,0x2B,0xCF,0xF3,0xCA,0xE6,0x60,0x9A,0x69,0xD4,0x26,0x3E,0xB9,0xD7,0x5D,0x15,0x50,0xF3,0xC8,0x96,0xA4,0x0E,0xFB,0xCC,0xBC,0xEC,0xDE,0x8C,0xC2,0x28,0x73,0xE5,0x56,0x7F,0x23,0x62,0x5C,0xCC,0x06,0x95,0x07,0x9F,0x9B,0x37,0x5B,0xAD,0x51,0xC9,0x69,0xAF,0x78,0xE6,0xCB,0x49,0x0E,0xEB,0x56,0x7B},
+    {0xE4,0xDF,0xE9,0x23,0x5D,0xA1,0x59,0x37,0xFB,0xAF,0x5F,0xE1,0xC2,0xC1,0x41,0xA2,0x44,0xA2,0xA0,0xAE,0xB6,0x00,0xB8,0xD2,0x07,0x24,0x67,0x41,0xC9,0x54,0xC9,0x16,0x3E,0x7B,0x44,0x28,0x6E,0xD5,0x94,0x42,0xA4,0x07,0x67,0x06,0x70,0x52,0x30,0x7B,0x83,0xD5,0x36,0x15,0x53,0xF1,0x35,0x3E,0x78,0x38,0xD1,0x75,0xB7,0x51,0xC6,0xF8,0x8E,0x94,0xF6,0x8F,0x3B,0x01,0x4A,0x65,0x06,0x40,0xB2,0xCF,0xB7,0x9D,0x1C,0xF7,0x3C,0x67,0x17,0xB9,0x83,0xF9,0x1E,0xAC,0x80,0x54,0x65,0x64,0x6F,0x21,0xF0,0xA4,0xC6,0x92,0x46,0x2B,0x9E,0xD1,0x37,0x06,0x9F,0x7C,0xB8,0x96,0x09,0x23,0x0B,0x89,0xC0,0xC6,0x7B,0x3F,0xF3,0x32,0x5C,0x07,0xA3,0xFC,0xA8,0x5A,0xE7,0x41,0xAE,0x71,0x70,0x20,0x56,0x2A,0x05,0xD0,0xA1,0x0B,0x7B,0x3B,0xE4,0xC8,0x6B,0xBE,0xE6,0xEB,0xFA,0xF5,0x54,0xE2,0x78,0xB1,0x2E,0xB8,0x5D,0x98,0xA6,0xD1,0x68,0x2F,0x8B,0x2C,0x85,0x30,0x08,0x1D,0x22,0x51,0x36,0x53,0xCB,0xB3,0x3E,0x85,0x57,0x6E,0x81,0xD6,0xD5,0x70,0xF2,0xC4,0x61,0xD7,0xC7,0x8C,0x54,0x8C,0xD7,0x20,0x6B,0x2D,0xBA,0xCB,0x5B,0xD8,0xEA,0x72,0x28,0x4C,0x2B,0x58,0xB6,0x21,0x9D,0x00,0x73,0x79,0x9B,0x7E,0x15,0xA6,0xA8,0x78,0xB1,0xD4,0x98,0xB0,0x0E,0x28,0xE5,0xBF,0x92,0xC0,0xA8,0xC3,0x5E,0x22,0x74,0x28,0x32,0x40,0x20,0xA7,0x35,0x7B,0x12,0x71,0x7D,0xB2,0x25,0xEB,0x21,0xC1,0xFC,0xA2,0xA4,0x56,0x1C,0x09,0x0B,0xFB},
+    {0xE9,0xCB,0x8B,0xE1,0x2B,0xAD,0xA4,0xCD,0x37,0xA6,0xAF,0x56,0x01,0xC2,0x4B,0xC1,0x02,0x92,0x39,0xCD,0xDF,0xC1,0x98,0x3B,0xE0,0x3F,0x77,0x18,0xF0,0xA3,0x3C,0xA5,0xAD,0xD4,0x7C,0x2F,0xF4,0x0D,0xA2,0xFE,0x55,0xCC,0xF7,0xE1,0x61,0x64,0xE8,0x56,0x96,0xFC,0x0F,0xD3,0x45,0x8E,0xB7,0x17,0xD6,0x79,0x70,0xFC,0x70,0xF1,0x47,0xF5,0x67,0xE3,0x1F,0x4A,0x31,0xC0,0x53,0x96,0xE7,0x3F,0xDE,0x1B,0xC7,0xFD,0x44,0xEF,0x44,0x05,0xDB,0xF9,0x34,0x8B,0x09,0xD4,0x83,0x74,0x37,0xAB,0xB4,0xC7,0xED,0xAB,0xE7,0x20,0x5F,0x2F,0x50,0x4A,0xCC,0xB0,0x97,0xB2,0x29,0xE7,0xDC,0x17,0xC0,0x39,0x8C,0xFE,0xE2,0xB7,0x09,0xBD,0x34,0x2E,0x05,0xFC,0x18,0x4F,0xDA,0xF8,0x7E,0xB6,0xB8,0x0D,0x27,0x2E,0x2E,0x36,0x0B,0x46,0x4D,0xC9,0x01,0x85,0x80,0x40,0x40,0x40,0x24,0x04,0xDC,0x32,0x9B,0x1F,0xDE,0x27,0x77,0x80,0x73,0x78,0x28,0xC0,0x15,0x0E,0x64,0x8B,0xDA,0xED,0x4F,0x44,0xAF,0x47,0xB5,0xDF,0xD0,0x14,0x18,0x0E,0xF0,0x4C,0x48,0x00,0xF1,0x09,0x44,0x52,0x72,0x40,0xF0,0x22,0x0A,0x04,0x68,0x6B,0x40,0x00,0xE0,0x22,0x4D,0x12,0xB9,0x9D,0xDA,0xED,0x5A,0xE4,0xBA,0xF3,0xE8,0xC6,0x3B,0x98,0x46,0x45,0xEE,0x61,0x50,0x68,0x3D,0x6B,0x7A,0x15,0x58,0x4F,0xFD,0x65,0x97,0x9B,0xAA,0x7B,0xAC,0xD3,0xA2,0xB8,0xAB,0xBA,0x59,0x3E,0x98,0x89,0x21,0x35,0x7C,0xC6,0x5E,0x4A,0x21,0x60,0xFE,0xC2,0x26,0x1D,0x67,0x44},
+    {0xED,0x7C,0x4E,0xC4,0x99,0x8E,0x3B,0x32,0x8D,0xC3,0x6F,0x3E,0xD7,0xCF,0xB9,0x83,0x8C,0x56,0x18,0xB9,0x29,0x92,0x88,0x71,0x8F,0x2D,0x12,0x30,0x89,0xFA,0x3E,0x88,0x20,0xBC,0xB4,0xAD,0x6F,0x4A,0x50,0x18,0xBF,0xA0,0x57,0xF7,0x98,0x0E,0x33,0xC6,0x62,0x36,0xA2,0x1E,0xB9,0xDA,0xD5,0xC9,0xA7,0x48,0x28,0x1F,0xAF,0xFB,0x82,0x7B,0x18,0x61,0xEB,0x82,0x10,0x84,0x62,0x29,0xE1,0x0D,0xCB,0x34,0xC6,0x76,0x9E,0x9E,0xBF,0xDE,0xE8,0x88,0xF1,0xFA,0x8F,0xBA,0x67,0xEA,0x28,0x1C,0xF9,0xE2,0x99,0x32,0xE7,0x3E,0x41,0xEB,0x46,0xEE,0x9F,0xF1,0xF2,0xC0,0x2D,0x39,0x60,0xC4,0xD9,0x92,0x6D,0x39,0x3E,0x58,0x14,0x05,0x87,0xE8,0x1C,0x12,0x65,0xF2,0xDA,0x1A,0x62,0x47,0x07,0xE5,0x5E,0x31,0x24,0x39,0x05,0x91,0xCA,0x36,0x13,0xA8,0xB8,0x7E,0x92,0x2A,0x95,0xD7,0x4E,0x6F,0x13,0x9E,0x8D,0x33,0xBC,0x5A,0xC0,0xF7,0xBC,0xE8,0xFF,0x4C,0xBC,0x2B,0xD5,0x5F,0x1C,0x5D,0x1E,0xDF,0xC8,0x96,0xCB,0x7A,0x26,0xBA,0x20,0x20,0x42,0xAF,0x35,0x10,0x31,0xBD,0xFD,0x7E,0x78,0x43,0x44,0x27,0xE7,0x36,0x7B,0xEA,0x46,0xF9,0x82,0x2B,0xA2,0x2B,0xA8,0x10,0x70,0x34,0x26,0x91,0x4E,0x02,0xEF,0xD7,0xD9,0xBF,0xC2,0x3B,0x1E,0x75,0x80,0xB1,0x7A,0x01,0x76,0x91,0x31,0x2D,0xCA,0x3E,0x18,0x8B,0x09,0xFF,0xC1,0x77,0xB7,0xB8,0xD7,0x95,0xAF,0xB9,0x8E,0xD3,0xC0,0x98,0xE2,0x66,0xDB,0x2A,0x70,0xEB,0x9E,0x59,0x13,0x9D},
+    {0x9B,0x13,0x37,0xFE,0xC3,0xCD,0x01,0x8E,0x70,0xED,0xFF,0xBE,0xCC,0xCF,0x05,0x0F,0xA4,0x56,0x50,0x85,0xB4,0xDE,0x21,0x41,0x08,0xA3,0x35,0xE9,0x20,0xC0,0xAC,0x45,0xCA,0x2F,0xD9,0x84,0x71,0xF4,0xBB,0x53,0x23,0x0E,0x67,0xEA,0xB4,0x36,0x4A,0x2F,0x03,0xAE,0x29,0x86,0x01,0x1B,0xFC,0x6D,0x13,0xCC,0xE0,0x23,0x48,0x9F,0xBD,0x24,0x39,0xCE,0xD0,0x50,0xA7,0x3B,0x68,0x17,0x1B,0x6E,0xEB,0xAC,0xB5,0xCA,0x63,0x82,0xAE,0x72,0x9B,0x6D,0x08,0x55,0x1A,0xB2,0x19,0x96,0x49,0x2A,0x77,0xC0,0x09,0x95,0x97,0x34,0x2D,0x1A,0xA5,0xEE,0x24,0x04,0xD2,0x22,0x6F,0xB2,0xBE,0xD0,0xD9,0xD1,0xBD,0xA8,0x13,0x28,0xBF,0x30,0x6C,0xCF,0x61,0xD9,0x39,0xF2,0x34,0x75,0x6F,0xF3,0xE7,0x95,0x79,0x47,0x39,0x3E,0xCD,0x15,0x48,0x8C,0xC2,0x2C,0x24,0x5B,0x5B,0x6C,0x83,0x4D,0x5F,0xCD,0x5F,0xCC,0x78,0x54,0xB3,0x29,0x6A,0xC8,0xE7,0xB1,0x60,0x1F,0x12,0xF8,0x7B,0x90,0xFE,0x78,0x23,0xB8,0xBA,0xE1,0x66,0x2E,0xF5,0xD6,0xB1,0x58,0x62,0x71,0xAB,0x73,0x7A,0xF1,0x8B,0x69,0xEE,0x73,0x8E,0x70,0x34,0xDC,0xF2,0x79,0x59,0xFC,0x0E,0x94,0xB0,0x0E,0x17,0xD2,0x6E,0xAD,0x36,0x68,0xE0,0x09,0x58,0x46,0x8F,0xD0,0x02,0x87,0x1B,0xA8,0x7F,0xE0,0x12,0x8C,0x23,0x06,0xD8,0x1B,0x99,0x9B,0x5C,0xA7,0x35,0x48,0x68,0x30,0x67,0xDF,0xCE,0x67,0x30,0xCC,0xE0,0xEA,0x97,0xD6,0xA2,0x38,0xDA,0x21,0x19,0x7C,0x56,0x36,0x17,0xA6},
+    {0x06,0xEE,0x80,0xE6,0xF4,0x79,0xD3,0xF1,0x38,0x31,0x68,0x23,0x75,0x63,0x17,0x35,0xB1,0x94,0x6C,0x11,0x40,0xF5,0x31,0x88,0x5D,0x88,0x24,0x77,0x6C,0x5B,0xC9,0x4D,0xC6,0x5F,0x96,0x6B,0x84,0xF3,0x50,0x8F,0x76,0x78,0x7A,0x40,0xA3,0x69,0x0E,0x80,0xBD,0xEB,0x00,0xC0,0xF4,0x0A,0xD8,0xA8,0x9E,0xDB,0xD3,0xF2,0xE8,0xAA,0xDE,0xAE,0xF1,0x39,0x9E,0x42,0x31,0xFD,0xD0,0xA4,0xC1,0x60,0x08,0xA6,0x60,0x99,0x40,0xB4,0x7D,0x01,0xF8,0x3D,0x75,0xDB,0x53,0x84,0x78,0x8E,0xD7,0x04,0xDC,0xC0,0x21,0xB7,0x61,0xFB,0xAF,0x87,0xC4,0x57,0x8B,0x09,0x32,0x13,0xED,0xDB,0x11,0x33,0x47,0x25,0xE1,0x6E,0x30,0x35,0xB9,0x6B,0x7A,0x11,0xA5,0x00,0xC7,0xE7,0x2D,0x36,0x56,0x9D,0xF0,0x7C,0x00,0x56,0x6A,0x6D,0x33,0xB2,0xCC,0xE2,0xA7,0x35,0xDF,0x7B,0xA8,0xEF,0x4C,0x07,0xAF,0xB2,0x17,0xEF,0x82,0xA5,0x3E,0x8F,0xE5,0x40,0x83,0x9B,0x94,0xE4,0x36,0x9C,0x5A,0xF0,0xD8,0xFA,0xB2,0x4C,0xBA,0x1C,0x43,0x60,0xAE,0x7B,0xF2,0x6B,0xF4,0xF1,0x1E,0xF9,0xA8,0xD5,0xFA,0x9B,0xE0,0xBB,0xC2,0x73,0x59,0x87,0x0D,0xCB,0x5E,0x3F,0xB7,0x20,0x36,0x4E,0x19,0xD8,0x07,0x85,0x48,0x6C,0x20,0x9B,0x12,0x94,0xEF,0x9A,0x4D,0x3C,0x66,0xE6,0xB3,0xDA,0x79,0x39,0x2A,0xCC,0xA3,0x61,0xC2,0x79,0x3A,0x0F,0xE1,0xDE,0x63,0xA4,0x45,0x0C,0x23,0x5B,0x90,0xDA,0x7F,0x3A,0xE1,0xE2,0x9C,0x7C,0xD5,0x46,0xD8,0x58,0xB8,0xC4,0xF3,0xF3},
+    {0xBA,0x3B,0x2A,0xB1,0x51,0x4B,0x35,0xAD,0xDF,0xE2,0xED,0xF0,0x28,0x8D,0x90,0xD4,0xEE,0xE0,0x25,0x6A,0xBC,0xE7,0x6D,0x5D,0xE6,0xC6,0xEB,0xD9,0x3D,0xC0,0x6B,0x1E,0xDC,0x84,0x69,0x65,0x61,0xAD,0xCF,0xA9,0xB1,0x22,0x36,0x59,0x2A,0x6E,0x98,0x28,0x5C,0xDD,0x66,0xDB,0x80,0xF2,0x5D,0x1E,0xDB,0x77,0xDF,0x7A,0x3A,0x58,0xB5,0x98,0xF9,0x85,0xF5,0xDA,0xEA,0x8D,0x9C,0x9C,0xC5,0xB6,0x0B,0xDE,0x04,0x43,0x36,0x57,0x10,0x97,0xEE,0x33,0xFA,0xFC,0x80,0x95,0x43,0x9C,0x1B,0x7A,0x16,0x87,0x01,0xDD,0x7C,0x1B,0x80,0x40,0xEA,0xC8,0x16,0xE0,0x8A,0x52,0xDB,0x8F,0xD3,0xFF,0xAA,0xE2,0x8E,0x2A,0xBD,0xB9,0x09,0xC2,0x81,0x11,0xDC,0xCF,0xAF,0xED,0x3A,0x8F,0x52,0x64,0x7E,0xF4,0x9E,0x22,0x87,0x67,0x40,0x37,0x89,0xDD,0xF6,0x7C,0x53,0x7E,0x70,0xFD,0x06,0xF9,0x5F,0x74,0x40,0xCE,0xF1,0x5C,0x6A,0xA0,0x21,0x6F,0xD6,0x82,0x10,0x9D,0x2A,0xE4,0x97,0x08,0x94,0xAE,0xD6,0x62,0x89,0x90,0x9F,0xA2,0x61,0x77,0xD6,0x2F,0xA3,0xCE,0x1F,0xB4,0xF4,0x19,0x07,0xAA,0x3F,0x57,0x49,0x19,0x5C,0x05,0xEC,0x23,0x85,0x7E,0x1D,0x30,0xBB,0xA2,0x9A,0x34,0x6E,0xD2,0x1B,0x51,0x0D,0x1C,0x5C,0xEA,0xB6,0x43,0x25,0x20,0xC2,0xA0,0xA7,0x24,0x00,0x10,0xF2,0xAF,0x2D,0xF5,0x2E,0xE6,0x66,0xF1,0x6F,0x4B,0x5D,0x1C,0x7B,0xCC,0x08,0x9E,0x11,0xC4,0x9B,0xBF,0x05,0xE2,0x01,0xAE,0x05,0x8B,0x92,0x2F,0xDB,0x61,0x7A,0xFC},
+    {0xD3,0x94,0x38,0x1F,0x41,0x98,0x81,0x5A,0x9F,0x51,0x2B,0x16,0x8B,0x5E,0xDD,0x45,0xBF,0x96,0xC8,0x4C,0x15,0x1B,0xC4,0xFB,0x37,0xB4,0xE2,0xC2,0x01,0xD1,0xF2,0x5F,0x7B,0x01,0x31,0xE3,0xAA,0x01,0x8A,0xF0,0x0A,0x49,0x41,0xAA,0x58,0xBF,0x0D,0x64,0x87,0x19,0xB6,0x22,0x29,0xB5,0xDA,0xA6,0x83,0x67,0x0E,0x73,0xC0,0xFD,0xB6,0x07,0xBA,0xD1,0xC1,0xFD,0xE2,0x77,0x8F,0xD7,0x14,0x2A,0x1F,0x03,0x4A,0xA6,0xA0,0x92,0xFB,0x82,0x34,0xA8,0xDC,0x53,0x10,0x94,0xD6,0x17,0x5A,0xD2,0xAD,0x92,0x49,0xC3,0x0A,0x51,0xC4,0x56,0x2D,0xD8,0xF2,0x24,0x6F,0x2C,0x78,0x59,0x2B,0x4F,0xA2,0xCD,0x13,0x60,0xCB,0x40,0x41,0xC6,0x0F,0x16,0xDC,0xE9,0x60,0xE8,0xA1,0x94,0xB0,0x99,0x2C,0x93,0x35,0x8C,0x90,0x7E,0x25,0x45,0xBE,0x94,0x06,0x20,0xDE,0x0C,0x25,0xD9,0xBA,0xA9,0x6F,0xF7,0xB8,0x19,0x95,0x2F,0xE7,0x08,0xC2,0x31,0xD4,0x7E,0x32,0xF9,0x95,0x6B,0xAE,0x19,0x6C,0x96,0x2F,0xFF,0x95,0x17,0xA7,0x4A,0xC0,0x13,0x8B,0xB3,0xED,0x7E,0x64,0xD8,0xF0,0xD8,0x24,0x61,0x39,0xF7,0x8F,0x7C,0x95,0x75,0xC0,0x78,0x3F,0x63,0xF3,0x2A,0x6E,0x6A,0xB8,0x24,0xA2,0xEB,0x2B,0x2F,0x3D,0xA8,0xB9,0xCA,0x24,0xE4,0x98,0x53,0x40,0x29,0x15,0x81,0x14,0xED,0xC1,0x1A,0xA3,0xEB,0xF3,0x82,0xF4,0xE2,0xEE,0x66,0xB9,0x64,0x2A,0x86,0x91,0xEF,0x82,0x8F,0x76,0x2F,0x88,0x72,0xA8,0xA2,0xD1,0xDD,0xC2,0x54,0x9A,0x3A,0xD0,0xFE},
+    {0x64,0x27,0xD3,0x63,0xE9,0x94,0x77,0x22,0xE6,0x8D,0x07,0xB1,0x46,0x7F,0x58,0xD8,0x34,0xCE,0xB3,0xF3,0x4A,0x54,0x53,0x9F,0xF9,0xA5,0x1C,0x9E,0x18,0xBC,0x6C,0xBE,0xF7,0xB1,0x0B,0x57,0xC5,0x58,0x7F,0x81,0xB6,0x85,0x7B,0x41,0xEE,0xAD,0x58,0x02,0x8F,0x02,0x28,0xE9,0x98,0x1B,0x7C,0x94,0x71,0x5A,0x0E,0xEE,0x47,0xFA,0xD8,0xD4,0x05,0x61,0x2C,0xBB,0xA7,0x20,0x35,0x67,0x09,0xC9,0x1C,0x5F,0xEF,0x72,0x77,0xA5,0x62,0x82,0x33,0xCB,0xBF,0xAC,0x35,0xA9,0xD8,0xE9,0xED,0xAB,0x71,0x54,0x3D,0x3C,0x01,0xE8,0x03,0xE7,0x92,0x18,0x5B,0x0F,0x99,0x7A,0x1E,0x17,0x5E,0x27,0x92,0x25,0xA0,0xEE,0x3E,0xBB,0xBD,0x0B,0x5F,0x11,0x3E,0x16,0xF7,0xB7,0x03,0xD3,0x1D,0x53,0xCB,0xBB,0xCB,0x21,0x2D,0xF4,0x32,0x35,0x86,0xC6,0x27,0xDB,0xD7,0xC5,0xA5,0xC1,0x45,0xF2,0xED,0x1F,0xC8,0xE7,0x1D,0x5F,0xC4,0xAF,0xFF,0xB3,0x3F,0x54,0xAD,0x9C,0x6B,0x13,0xF4,0x1B,0x35,0xFA,0x63,0x3E,0x6B,0x3C,0x20,0x4A,0x95,0xD8,0x4F,0xB7,0x77,0x77,0x7E,0xC2,0xDD,0x75,0x5C,0x29,0x57,0x06,0x96,0x78,0x00,0x5B,0x89,0x78,0x5B,0x4C,0xBE,0x79,0xD7,0xDC,0x58,0x5E,0xB9,0x2A,0x57,0x7C,0x97,0xC9,0xFB,0xF1,0x65,0xF6,0x6A,0x3B,0xB2,0x9C,0xB0,0x03,0xF5,0xF1,0x1D,0x89,0x2A,0x8A,0x1A,0x90,0xFD,0x00,0xBC,0x88,0xDA,0x02,0xFE,0x9B,0xBA,0xED,0xA8,0xBC,0x8A,0xAB,0xE2,0x61,0x82,0x60,0x70,0x94,0xF4,0x26,0x95,0x0E,0xB8,0x7C},
+    {0x99,0x24,0x99,0xD8,0x4A,0xD0,0x1A,0xF6,0x16,0x28,0x94,0xC7,0x4D,0xDA,0x77,0xBB,0x60,0x7E,0xC8,0x63,0xCF,0x63,0x56,0x8F,0x52,0xF9,0xC5,0x00,0x85,0xE2,0xBB,0x9B,0x1E,0x6B,0xC6,0x53,0x7F,0xCE,0x8D,0xFA,0x68,0xD6,0xF9,0x8A,0xD0,0x71,0x9C,0xE1,0x1F,0x05,0xAE,0xC7,0x38,0x5B,0xDD,0x9D,0xCA,0xDF,0xE1,0xA8,0x50,0x1D,0x49,0x2E,0x41,0x7C,0x4D,0xF4,0x16,0x27,0x6F,0x2B,0xA7,0x7D,0x86,0x83,0x52,0xFC,0x50,0x61,0x6A,0x23,0x68,0xB1,0x4F,0xDB,0x7A,0xA3,0x92,0x53,0x57,0x6F,0xBE,0x36,0x1E,0x07,0x9E,0xB5,0xFE,0xB6,0x77,0xA3,0x42,0x11,0x4B,0x99,0x5F,0x92,0x33,0x15,0x23,0x71,0x5A,0xA5,0xE4,0x6E,0x8C,0x4F,0x44,0x07,0x88,0x4D,0x04,0x0B,0x8C,0x32,0xA2,0xF4,0x29,0xB0,0x10,0xE3,0xD0,0xEE,0x7E,0xD0,0xBA,0x9C,0xD7,0xF2,0xA3,0x13,0x33,0x31,0x3D,0x6C,0x5A,0x12,0x47,0xDC,0x4A,0xA3,0x4C,0x9E,0x32,0x2F,0x2F,0x4A,0x53,0xBD,0x42,0xB2,0x4C,0x74,0x2B,0xD0,0x94,0x15,0x82,0x0C,0xEA,0xD5,0xBF,0x5B,0xC6,0xE1,0x3C,0x05,0xE1,0x06,0xEE,0x01,0x2A,0xAD,0x12,0xE8,0xC2,0xBC,0xAC,0xF1,0x32,0x67,0xC1,0x46,0xCB,0x1D,0x29,0x00,0xD7,0x5A,0x54,0xB2,0x9E,0x5B,0xFA,0xD5,0x39,0xFE,0x18,0x9E,0x91,0xD5,0x00,0xAF,0x2D,0x43,0xB2,0xC2,0xA0,0xF2,0xE7,0xF6,0xD9,0xE3,0xB8,0x27,0x45,0xC3,0x52,0x83,0xCE,0x76,0xFA,0xE4,0xB0,0xA6,0x50,0xD0,0x8A,0xF5,0x97,0xFA,0x3F,0xA3,0x03,0x31,0x4A,0x10,0x24,0xD1},
+    {0x93,0x98,0xA6,0xDE,0xBF,0x65,0x64,0x54,0x5C,0xDC,0x4D,0xB8,0x73,0xC5,0xE9,0x98,0xCC,0x38,0x46,0x64,0xF0,0xFA,0xE4,0x0D,0xF8,0x63,0x55,0x00,0xE8,0x5E,0xA0,0x0D,0xF0,0x88,0xAC,0x76,0x43,0x08,0x26,0x87,0xDF,0x52,0x81,0x1F,0x67,0x04,0x50,0x1A,0xA2,0x37,0x41,0x93,0xD5,0x7D,0x1F,0x81,0xD6,0x38,0x36,0x5B,0xB8,0x35,0x5A,0x6B,0x87,0x26,0x0C,0x5D,0xBF,0x26,0x13,0x7A,0xFC,0xA4,0x2C,0x7C,0x9D,0x1D,0x7C,0xEF,0x39,0x25,0xFD,0xF0,0x11,0x72,0xD5,0x67,0x23,0x1C,0xC6,0xA6,0x66,0x49,0x99,0x9D,0xEB,0xDB,0xA8,0xC1,0xAB,0xD3,0x74,0x3B,0xED,0xFE,0x95,0x31,0xBB,0x54,0x9A,0x8E,0xB5,0xB7,0x28,0xC0,0x88,0xD1,0x2B,0x09,0xA4,0xC5,0x74,0x7F,0x90,0x2E,0xA3,0x23,0x3F,0xA6,0xEF,0x5A,0x7D,0x79,0x20,0x2C,0x5F,0x0E,0xFD,0xEF,0x68,0x1B,0xAE,0xC2,0x58,0xD3,0xB9,0xAC,0xE1,0x33,0x3D,0x75,0xE3,0x4A,0xB4,0x87,0xEF,0xDA,0xF4,0x84,0xAB,0xFA,0x45,0x76,0x1C,0x55,0x5B,0x11,0x7E,0x13,0xA5,0xFF,0x51,0x53,0xBC,0x38,0x17,0x69,0x0C,0x18,0x13,0x66,0x09,0x41,0x23,0x54,0x5A,0x16,0x2B,0xB3,0x00,0xFF,0x10,0x83,0x2D,0xC7,0x4C,0x8B,0x5B,0xD1,0x84,0x76,0xA3,0x0C,0x6F,0x30,0x00,0xAF,0xEB,0x6F,0xA4,0xE6,0xF0,0x60,0xD1,0xF9,0xBB,0xB0,0xC5,0x33,0xF5,0xAF,0x3F,0xAE,0x37,0x3E,0x90,0xE7,0x0A,0xD7,0x9E,0xC7,0x9B,0x9E,0xA9,0xBE,0xD0,0x58,0xA6,0xC2,0x0E,0x9C,0xD2,0x57,0x04,0x4A,0x13,0x6B,0x89,0xE9},
+    {0x88,0xE9,0xF6,0x19,0x64,0xF4,0x70,0xDF,0x6C,0x31,0xB8,0x72,0xCF,0xB6,0x99,0x7C,0xE0,0xE5,0x43,0x2E,0x71,0x79,0x6B,0x90,0x9C,0xE8,0xEB,0x9F,0xF6,0x3B,0xD4,0xDA,0x55,0x4A,0x41,0x73,0xB3,0x30,0x13,0x79,0x70,0xB1,0x7E,0xAE,0x95,0x46,0x95,0x3D,0x2B,0x32,0x3B,0x07,0xBD,0xA4,0xEA,0x7E,0x99,0x14,0x3D,0xCE,0x3A,0x81,0x91,0xBB,0xA3,0x1F,0xAC,0x11,0x3D,0x24,0x3F,0x51,0x51,0x80,0xEE,0xEA,0x07,0xBD,0xFB,0xE2,0x5F,0x8C,0x71,0x52,0xD7,0x2D,0x48,0x85,0x87,0x4B,0xE0,0x09,0xC0,0x97,0xA0,0x6D,0x61,0xD8,0x8B,0x52,0x92,0x5C,0xBF,0x05,0xBE,0x5E,0x75,0xF0,0x98,0x3A,0xFB,0x9C,0x40,0x98,0x61,0x77,0x2B,0xAD,0xB0,0xA6,0x90,0x90,0x3C,0xD0,0x88,0x64,0xCB,0xFE,0x3B,0xB1,0xB8,0x8E,0xB5,0x2D,0xBC,0x5B,0xF4,0x90,0x38,0x20,0xF3,0xBF,0x4B,0xE2,0x3A,0x17,0xFD,0xB8,0xAC,0x37,0xBC,0x71,0xAD,0xF5,0x31,0xD9,0xE0,0x85,0xD1,0x72,0x8B,0x80,0x60,0xA2,0xED,0xF7,0x8F,0xED,0xF1,0xCC,0x74,0xB9,0xC7,0xB0,0xEE,0xAF,0xBA,0x08,0x0F,0xB6,0x98,0xC9,0x20,0x6E,0x87,0xB8,0x0F,0xA3,0x64,0x8E,0xFF,0xE6,0x2D,0x3E,0x66,0xB8,0x82,0x0A,0xE2,0x9B,0xF5,0x92,0x62,0xBE,0x47,0x21,0x94,0x2E,0x1B,0xF4,0x41,0x80,0x9A,0x87,0x4C,0x2F,0x3C,0xC0,0x78,0x6D,0x01,0x1E,0x15,0xCF,0x4B,0x7D,0xC9,0x1B,0x3D,0x17,0xAC,0x3A,0x43,0xF1,0xF1,0x7C,0xDE,0x4E,0x23,0x67,0x44,0x30,0xC8,0x2B,0x6B,0xEA,0xEB,0xE6,0xB2,0xAB},
+    {0x04,0x0F,0x75,0x82,0x7F,0x64,0x51,0x53,0x25,0x87,0x68,0x28,0x2B,0x9A,0xD8,0xA6,0x6E,0x9E,0x60,0x34,0x46,0xE5,0x15,0x93,0x7B,0xD1,0xEC,0x41,0x2E,0x29,0xEB,0xB7,0x6E,0xA7,0xA0,0xE6,0xF9,0xF4,0xD2,0xE7,0x0F,0x23,0xC8,0xDD,0xC9,0x8B,0xE0,0x9E,0x80,0x65,0xF3,0x60,0xF7,0xDD,0xC7,0x1D,0x8B,0x72,0xC4,0x2C,0xE4,0x4E,0x90,0x6E,0xF1,0x20,0x88,0x6B,0x63,0x4B,0x8F,0x15,0x70,0xCE,0x7B,0x49,0x5C,0x0D,0xC7,0x4A,0x68,0x14,0x8D,0xBB,0x90,0x88,0x1A,0xD1,0x48,0x52,0xA7,0x21,0xA9,0xEC,0x34,0xF4,0x0B,0xF4,0x49,0x38,0x12,0x58,0xB6,0xEB,0x4E,0x68,0xAE,0x98,0x9F,0xD0,0x19,0x76,0xD0,0xA8,0x01,0xC3,0xDE,0xC2,0x86,0xF3,0x8C,0x2D,0x92,0x95,0x52,0x26,0x64,0x41,0x93,0xEF,0x5D,0x20,0xA8,0x8A,0x96,0xEE,0xE3,0x08,0x63,0x54,0xD0,0x32,0x62,0xD1,0xBE,0x06,0x4F,0xBA,0xB1,0x16,0x5F,0x5C,0x2E,0xA0,0x00,0xBA,0x6A,0xB9,0x2D,0x91,0x59,0x3C,0x74,0x37,0x4D,0x4E,0x0E,0x83,0x1B,0xBF,0x36,0x52,0x81,0x99,0x07,0xC1,0x52,0x8E,0x81,0xDF,0x57,0x4D,0x52,0x71,0x4C,0xDE,0xDF,0x2E,0xB3,0xAA,0x52,0xB5,0x6C,0x92,0x4C,0xC3,0x79,0x43,0x7F,0xC6,0x31,0x5B,0xF1,0xA9,0x59,0xCD,0x17,0xBC,0x71,0x3D,0xC8,0x50,0x07,0xDC,0xC4,0xC7,0x6D,0xB3,0x77,0xC4,0x80,0xC1,0x55,0x40,0x80,0x8D,0x84,0xA4,0x3D,0xBF,0xE5,0x54,0x6E,0xCC,0x44,0xD3,0x4D,0xBB,0xED,0xA8,0x8B,0x51,0xB8,0xB9,0x52,0x2A,0x9D,0x62,0x4E,0x82},
+    {0x28,0x22,0x4F,0x9B,0x66,0x12,0x16,0xCC,0x5D,0xFA,0x24,0xE1,0xB1,0x6A,0xA9,0x1D,0xF1,0xA2,0xC2,0x5A,0xB8,0x64,0xE0,0x92,0x8A,0xEF,0xAF,0xF6,0x88,0xAB,0xBC,0xAE,0xC9,0xF7,0x01,0xC3,0x5F,0x91,0x74,0x7B,0xA8,0xC1,0x8E,0x4D,0xC2,0x3A,0xAE,0x92,0xE5,0x92,0xFB,0xF6,0x46,0x9A,0x2A,0x43,0xDD,0x08,0xAF,0xE8,0x98,0x60,0x24,0xB4,0x41,0xDC,0x64,0x99,0x3F,0xD7,0xA0,0x3B,0xCA,0xC5,0x0F,0x67,0x3E,0xE1,0xE9,0x30,0x6E,0xE3,0xD5,0x27,0x5E,0xC3,0x3C,0x6A,0x9E,0x4D,0x35,0x54,0x3D,0x72,0x49,0x05,0xBC,0x38,0x1D,0xFA,0xB5,0x11,0x81,0x71,0x75,0xA3,0xAD,0x7D,0x79,0x39,0xC7,0x82,0x82,0xCA,0xED,0x76,0x08,0xDF,0xB8,0xA7,0x59,0x29,0xAD,0x1C,0x0C,0x34,0x1D,0x6C,0x49,0xD8,0xB2,0xEB,0xDB,0x52,0xC3,0x8B,0xA9,0x5E,0x73,0xE4,0x62,0x6C,0x22,0xF9,0x22,0x86,0xED,0x0F,0x01,0x60,0xED,0xE8,0x4D,0x14,0xB9,0x8B,0x44,0xA8,0x71,0x64,0xF9,0x75,0xB1,0x4F,0xF5,0x15,0x98,0x83,0x8E,0x67,0x8B,0x64,0xC9,0xA0,0x90,0x1F,0x04,0xB9,0x53,0x01,0xE4,0x63,0x9A,0x4C,0x30,0xD9,0x2D,0xFF,0x5B,0xE4,0x59,0xCE,0xDA,0x74,0x6D,0xF2,0x28,0x38,0x27,0xD8,0xB2,0x91,0xF4,0xFA,0xE7,0x0F,0x2A,0xA1,0x1E,0x6D,0x7C,0xAF,0x9A,0x92,0x0A,0x47,0x1B,0x21,0x48,0x69,0xFE,0xB5,0xA0,0x90,0x0F,0xDA,0xDF,0xD6,0x91,0xC5,0xD7,0x3F,0x81,0x3A,0xDE,0xD1,0x66,0x9E,0x9F,0x44,0x20,0xC1,0xC1,0x96,0xC4,0x56,0x89,0x17,0xF2,0x7C},
+    {0x8D,0x6D,0x97,0x87,0xF6,0xAB,0x5A,0xC1,0xAC,0x34,0x8C,0xBC,0x6B,0xFD,0x99,0x51,0x62,0x55,0xEE,0x47,0xA3,0x97,0x1F,0xDF,0xBD,0x1E,0xD3,0x88,0x0A,0x85,0xB9,0x29,0xC8,0x36,0x3C,0x74,0x1F,0x43,0x6C,0x78,0x34,0xDC,0x06,0xE3,0x6C,0xA5,0x56,0x0F,0x66,0xD1,0xE9,0xE4,0xDD,0x05,0x9C,0x1F,0xE5,0xC9,0x18,0xCE,0x34,0x61,0xFE,0x60,0xAE,0xDD,0xB9,0x62,0x10,0xCE,0xBA,0x44,0xFE,0x20,0xD5,0xF0,0x9C,0x89,0x56,0x6A,0xA5,0x64,0x00,0xA1,0xD9,0x94,0x76,0xE2,0xB3,0x07,0x97,0x8F,0xEC,0xC9,0xC5,0x99,0x3B,0x04,0x5B,0xAE,0x03,0x7F,0x20,0x50,0x83,0xCB,0xA6,0x7D,0x60,0x0C,0x42,0x07,0x4E,0x24,0x5C,0x89,0x3B,0xBB,0xB3,0x51,0xCB,0x03,0xA9,0x55,0x1F,0xB6,0xCB,0x38,0x4A,0xB9,0x60,0x4A,0xEF,0x99,0x44,0x56,0xF0,0xC1,0x94,0x47,0x63,0x53,0x38,0x84,0xE9,0x05,0x03,0x3E,0xE0,0x1F,0xE9,0x00,0xA9,0x36,0x2F,0x79,0xFF,0x14,0x5D,0x78,0x71,0x13,0x1E,0x3C,0x59,0x13,0x7F,0xFD,0xA1,0x6C,0x4E,0x46,0x62,0xB5,0x96,0x07,0xDD,0x27,0xBA,0x64,0xAD,0x02,0x75,0xB1,0x43,0x5B,0x95,0x67,0x7A,0xC5,0xC0,0xB1,0x51,0x94,0x04,0x58,0x9E,0xDA,0xB4,0x4D,0x89,0x61,0xAC,0xD2,0x1A,0x29,0x6F,0x57,0xA7,0x59,0xA1,0x36,0xC2,0x0C,0x99,0xAE,0xB4,0x7F,0x67,0xAF,0x3C,0xA6,0x34,0xD0,0xEA,0x2E,0xFD,0x2F,0x62,0xC4,0x98,0x0B,0x1D,0xBB,0x1B,0x40,0xEC,0xB1,0xD8,0x96,0x1C,0x66,0xD7,0x5E,0xAC,0x86,0x63,0x04,0x8A,0x1F},
+    {0x69,0x13,0xE5,0x68,0xAF,0x5C,0xB8,0xA2,0xB4,0x53,0xF6,0x14,0x8A,0xE8,0x0C,0x24,0xF4,0xC3,0xE0,0xFD,0x55,0x60,0x55,0x1C,0xDE,0xF0,0x05,0xFE,0xD8,0x2A,0xFB,0xD0,0x68,0xCE,0xAB,0xD7,0x96,0xA9,0x39,0x2A,0x7E,0x7F,0x07,0x1D,0x4F,0x4E,0x60,0x6D,0xDC,0xB1,0x95,0xFB,0x71,0x0A,0xC3,0x03,0x08,0x35,0xC0,0x01,0x00,0xCA,0xE4,0x7F,0x32,0x2C,0x8B,0xD9,0xCB,0x19,0x45,0xCC,0x73,0x1A,0xDA,0xC4,0xD5,0xF7,0xF2,0xED,0x31,0x0E,0x0B,0x1C,0x91,0xBB,0x80,0xC8,0x05,0xBD,0xC0,0x8A,0xA4,0xD8,0x3A,0x2D,0xFF,0x2B,0xA4,0x42,0xD5,0x10,0x99,0xE9,0xF3,0xCF,0x5A,0xE6,0x7E,0x44,0xB3,0xF4,0x38,0xC2,0x0B,0xB8,0x6F,0x96,0xC9,0xEA,0xF0,0xC1,0x62,0xF0,0x55,0xD6,0x22,0x51,0x1A,0x9B,0x85,0xB2,0x12,0x0D,0x00,0x71,0x48,0xFE,0x9B,0xFC,0x5B,0xC5,0xF7,0x8F,0x5A,0xA0,0xA3,0xF2,0x4C,0xEF,0xC2,0xB5,0x7B,0xB0,0xE4,0xE7,0x22,0xD8,0x70,0xE2,0xB6,0x7A,0x8A,0x2D,0xBE,0x22,0x88,0xE6,0x71,0xD2,0x9A,0x72,0xB1,0xCC,0x03,0x58,0x2A,0xE3,0x92,0xFA,0x42,0x6B,0xFE,0xBA,0x68,0x06,0xD7,0xAE,0xB0,0x04,0x03,0x67,0x6E,0x01,0x49,0x21,0x16,0xC9,0x4D,0x4B,0x58,0xA4,0x5F,0x46,0x07,0xAE,0x0E,0xA2,0x7F,0xBC,0x6F,0x52,0x15,0x37,0x4F,0x17,0xA3,0x7E,0x44,0xA1,0x50,0xEE,0x85,0x3C,0xD9,0xB9,0xAD,0xCB,0x73,0x8A,0x0A,0x8D,0x4F,0x0B,0xA4,0xF3,0xF2,0xFB,0x43,0xB8,0xC4,0x2B,0xF8,0xE3,0x9F,0x01,0xD5,0x67,0x8C,0x74},
+    {0x39,0x6A,0xC9,0x85,0x91,0x62,0x56,0x1B,0xFA,0xB2,0xAC,0xB8,0xDC,0x43,0x2E,0x2E,0xDE,0x7F,0x26,0x96,0x29,0x26,0xC2,0x0C,0x24,0xD8,0x45,0x6D,0x34,0xD7,0x5E,0x6A,0xE8,0xB8,0x12,0x0D,0xBD,0x25,0xA1,0xEF,0x8B,0x5B,0x38,0x62,0xA6,0x21,0x55,0x83,0xAF,0xAD,0xFA,0xE4,0x26,0xF6,0x43,0xD4,0x01,0x73,0x09,0xF2,0xB6,0x7C,0x49,0x43,0x19,0xA6,0xE9,0xE8,0xC8,0xA6,0x20,0xFD,0x0F,0x9B,0xED,0x8F,0xEB,0xAC,0xD0,0x09,0x74,0x4D,0x3A,0xB4,0x5C,0xDF,0x2A,0xF7,0x11,0x45,0x0B,0x43,0xE8,0x8D,0xA5,0xA0,0x8B,0x9A,0x26,0xF5,0x72,0xE4,0x3D,0xAB,0x35,0x3B,0xB5,0x8A,0x82,0x7C,0x09,0x65,0x4B,0xDC,0xC2,0xA4,0x32,0x3F,0x20,0xC2,0x5F,0x7D,0xDB,0xC6,0x73,0xCC,0x0C,0x56,0xD5,0x94,0xDA,0x35,0x17,0x1A,0x8D,0x15,0x5B,0xCF,0xA8,0x85,0x79,0x8D,0x8A,0xA4,0xE1,0xD0,0x2B,0x2F,0x2B,0x1C,0x82,0x02,0x07,0x0E,0x09,0x24,0x48,0x12,0x64,0x7D,0x0F,0x01,0xE2,0xDD,0x00,0x20,0x2A,0x0F,0x90,0x02,0x85,0xDB,0xD7,0xEF,0x76,0xA8,0xA5,0xB2,0x9E,0x3C,0xBD,0x08,0x03,0x0E,0x0E,0x40,0x92,0x01,0x3F,0x20,0xBA,0xFF,0x90,0x48,0x19,0x0F,0xD8,0xDB,0xCA,0x49,0xC5,0x09,0xCD,0xA2,0xC7,0x80,0xD6,0x3F,0x0B,0x76,0x01,0x57,0xBF,0xA6,0x01,0xB3,0x93,0x67,0x92,0x8F,0x11,0x93,0x8D,0xDB,0x37,0x53,0xA4,0x55,0x83,0x57,0xC9,0xA5,0x24,0xA2,0x70,0x99,0x92,0x2F,0x6A,0xDE,0x17,0x9B,0x21,0x9E,0x77,0xD3,0x26,0x64,0xA0,0xC4},
+    {0xDD,0x94,0x8F,0x1E,0x9E,0x88,0x41,0x25,0xB7,0x61,0x69,0xEB,0xD0,0x14,0x5C,0xC7,0xD6,0xC8,0x71,0x98,0x1F,0x3C,0xF1,0x9A,0xC9,0x91,0x0C,0xBE,0x71,0x9B,0x02,0x1F,0x78,0x3E,0x79,0xAC,0x41,0xC9,0xA3,0xD1,0xDF,0xAB,0x3C,0x39,0xC7,0xC2,0xD8,0x58,0x9D,0x44,0x3E,0x65,0x45,0x4C,0xCA,0xCF,0xFA,0xD0,0x1B,0x2B,0x6C,0x73,0xA4,0x49,0xEB,0xB2,0x1D,0x74,0x46,0x33,0x53,0xB1,0x76,0xAE,0xA0,0x2D,0x9C,0x67,0x4B,0x6D,0x01,0xEB,0xE9,0x80,0xC8,0x8B,0x04,0x89,0xE9,0x92,0x5B,0x1E,0xB8,0x76,0x16,0x6D,0xC7,0x45,0x78,0x7D,0x3A,0xB2,0xCE,0x63,0xFE,0xF4,0x50,0xFB,0xC7,0x54,0x81,0xA1,0x1E,0x7A,0x89,0x09,0xB7,0x80,0x76,0x36,0x3C,0xD2,0x4D,0x8A,0x22,0x08,0x96,0xF5,0x66,0x37,0xF2,0x95,0x33,0x10,0xB9,0x7E,0x23,0x93,0x41,0x87,0x8F,0x55,0x12,0x69,0xE4,0xE8,0x57,0x22,0xF1,0x72,0xF3,0x8F,0x6C,0x5A,0x71,0x00,0xA2,0x5A,0x38,0x01,0x74,0x6C,0x27,0x9B,0xA3,0x59,0x23,0xEC,0x0A,0x6C,0x90,0x30,0xEC,0x91,0x08,0x00,0x8E,0x25,0xED,0xA4,0xC0,0x4A,0x66,0xB9,0xED,0xB2,0x7C,0x1D,0x9C,0x55,0xCE,0xE8,0xD3,0x6C,0xD4,0x1D,0x29,0x23,0x88,0xEE,0xC2,0x46,0x96,0x6B,0x06,0xBB,0x93,0x29,0x7F,0x76,0x53,0x59,0x15,0x7A,0xC3,0x3A,0x4A,0x17,0xBB,0x48,0xB6,0x5E,0x51,0x6F,0x50,0xA5,0x15,0x94,0x84,0xEF,0xD8,0x6C,0x19,0x06,0xC5,0x70,0x6E,0x50,0xB8,0x21,0x06,0x7A,0xAE,0x7D,0xA0,0x4A,0xD5,0x82,0x9C,0x0D},
+    {0x73,0x08,0x76,0x10,0x49,0xB6,0xF5,0x13,0xDF,0xA7,0x2B,0x78,0x9E,0x67,0x6F,0xFC,0x08,0x79,0x29,0x47,0x12,0xA0,0x80,0xF2,0x57,0x42,0x09,0xC5,0x97,0x31,0xB7,0x76,0x3C,0xE8,0x9C,0xDD,0x01,0x0F,0xCC,0x18,0x80,0xFB,0x9F,0xDA,0x82,0x5C,0x45,0xF3,0x0B,0x86,0xE0,0x87,0x20,0x22,0x1D,0xFF,0xEF,0x7D,0xED,0x5C,0xE5,0xA1,0x02,0x16,0x39,0xD0,0x49,0x31,0x27,0x81,0xA0,0xA7,0xEE,0x09,0x50,0x3D,0xCF,0x92,0x1C,0xCA,0x94,0xD1,0x25,0xB4,0x37,0xA8,0x4F,0xBC,0xFC,0xE3,0xFA,0xBD,0x3B,0x42,0x67,0xAD,0xAA,0xA4,0x7C,0xDD,0x2F,0xF1,0xA3,0x85,0xA3,0xE7,0xF4,0x2D,0x82,0x0F,0x52,0x48,0xBF,0x6A,0x28,0x04,0x8F,0x39,0x2D,0x83,0xD2,0x13,0xD9,0xFF,0xE2,0x87,0x28,0xCE,0xC6,0x0D,0xD8,0xD4,0x4D,0xCC,0x62,0xC1,0xCC,0xA8,0x5D,0x5F,0x0D,0xAC,0x73,0xA0,0xFF,0x42,0x6B,0xC3,0x01,0x79,0xB4,0x9E,0x7F,0x6E,0x43,0x1D,0x97,0xEB,0xF2,0xC8,0xE5,0xFB,0x2A,0x45,0xC2,0x07,0x19,0x4B,0xCD,0xC0,0x5A,0xA0,0x6B,0xBB,0xB2,0x8D,0x4F,0x55,0x03,0x9F,0x5B,0x7A,0xCA,0x88,0x9E,0x01,0x9F,0xFD,0x08,0x7B,0x5A,0x71,0xCF,0xB1,0x30,0x79,0xE0,0xD7,0xDC,0xA2,0xE5,0xFA,0x8D,0x74,0x42,0x73,0xF5,0xF5,0x36,0x98,0x1E,0xDC,0x7D,0x2C,0x93,0x9E,0xB2,0x3B,0xC0,0xA8,0xAC,0x6E,0x0B,0x0E,0x02,0xAB,0xE9,0x80,0x7D,0x52,0x9C,0xAC,0xFA,0x33,0xF7,0x09,0x1C,0xC8,0x31,0xB4,0xDB,0x0D,0x41,0xC1,0x13,0x16,0x16,0xA0,0x00,0x65},
+    {0x24,0xA6,0xA5,0x9F,0x46,0x3D,0x3B,0x4A,0x8D,0xEE,0x91,0x8D,0xBE,0x72,0x13,0xDB,0xF1,0x4E,0x83,0xA1,0x55,0xA5,0x54,0xBC,0x6D,0x51,0x9A,0xAA,0x79,0x5A,0x65,0x14,0x6C,0xA4,0xDF,0x48,0x26,0x19,0x1E,0xEC,0x86,0xDA,0x21,0xF5,0x64,0x56,0x70,0xF1,0x54,0xB1,0xE3,0x9F,0x4C,0x73,0x46,0x65,0x37,0x98,0x17,0x06,0xD9,0xE4,0x7E,0x78,0xF7,0xBD,0x58,0x1C,0xE3,0x6A,0x37,0x37,0xD9,0xCF,0x59,0x88,0xE0,0x69,0x9E,0xF4,0x75,0xB1,0xFE,0x31,0x4B,0x4A,0x71,0x37,0xFE,0x7A,0xE3,0x95,0xF1,0x5A,0x57,0x1A,0xEA,0x9A,0x97,0x91,0x55,0xBF,0x9E,0x5C,0xA0,0xD3,0xBF,0x5E,0x50,0x05,0x27,0xB6,0xC5,0x48,0x99,0xE7,0xF9,0x7B,0x25,0x5B,0xEA,0x5A,0xA4,0xBA,0xD4,0x61,0xB9,0xAE,0xF7,0xCF,0x6E,0x1C,0xAB,0x62,0x29,0xB7,0xD9,0x1F,0x7D,0xC3,0x9E,0x13,0x7C,0x96,0x1A,0x7F,0x6F,0xD0,0x61,0xDC,0x6B,0x08,0xB0,0x8F,0x9D,0x48,0x37,0xBF,0x0B,0x1F,0xEE,0x2A,0x76,0x90,0x6B,0xCA,0x5D,0x53,0xE2,0xBA,0xA3,0xD5,0x0F,0x3D,0x3D,0x1E,0xCF,0x82,0x92,0x13,0x6D,0x22,0x38,0x24,0x9D,0x34,0x4E,0xE8,0xF5,0x6D,0xC4,0xAB,0x47,0x4D,0x8C,0x71,0x5E,0x4D,0x2C,0x63,0x84,0xC0,0xC8,0xAB,0x6F,0x57,0x96,0x19,0x16,0x7A,0xC0,0x6E,0x93,0xCE,0xCD,0x59,0x23,0x76,0x29,0x77,0x02,0x5D,0xCF,0x23,0x7C,0x35,0xAC,0x34,0x57,0x35,0x2F,0x6A,0x38,0x4A,0x05,0x27,0x01,0x6D,0x5B,0x8B,0xC9,0xD9,0x83,0x3F,0x1D,0xE5,0x84,0xC3,0x11,0x8A},
+    {0xE4,0x56,0x13,0x64,0xAB,0xA4,0xB6,0x62,0x9E,0x86,0xB7,0x14,0x2C,0x88,0x2E,0x6B,0xFD,0x0B,0xFD,0x30,0x57,0x49,0x74,0xA3,0x1E,0xE8,0x5C,0x99,0x77,0x0F,0x32,0xB7,0x86,0xB3,0x84,0x51,0x9B,0x75,0x52,0x12,0xE5,0x4C,0x23,0x53,0x40,0x34,0xE4,0x4E,0x4D,0x35,0xF2,0x5D,0x54,0x90,0x8C,0x23,0xDE,0xFE,0x70,0x42,0x45,0x0F,0x23,0xCC,0x96,0x83,0xAF,0xBB,0xF6,0xF6,0x18,0x75,0x70,0x18,0xB6,0x35,0xF9,0x37,0xC2,0x90,0x31,0xA2,0x8C,0x74,0x03,0x51,0x2C,0xEA,0xE6,0x4F,0xF4,0xF2,0xB9,0xE0,0x05,0x8C,0x51,0xAA,0x02,0xE6,0x6E,0xBC,0xCD,0xBD,0xD4,0xE0,0x73,0x11,0x7A,0x62,0xAA,0xED,0xB2,0x5D,0x2F,0xD7,0x77,0xED,0xC8,0x8C,0xF8,0x30,0xDD,0xD0,0xF2,0xEF,0x0C,0xA8,0xD5,0x29,0x7F,0x8F,0x56,0xCF,0x79,0x84,0xCF,0x3B,0x95,0xBF,0x3B,0x3C,0xC3,0xAB,0x10,0xFC,0xBF,0x10,0xD8,0xC6,0x98,0x01,0xF8,0x0C,0x13,0x2D,0x38,0xAD,0x80,0xB6,0x11,0x9A,0x04,0xE3,0x4F,0x97,0xDA,0x3D,0xF6,0xE4,0x73,0x67,0x55,0xAA,0xF1,0xC4,0x25,0xA4,0x1D,0xAB,0x0F,0x76,0x37,0x2F,0x3F,0x83,0x55,0xED,0x83,0x1F,0xA8,0x52,0xEB,0x6C,0x9B,0x17,0x4F,0x9D,0xE1,0x48,0x5D,0x64,0x4B,0xDE,0x91,0x5E,0x72,0x1C,0xDA,0xF1,0x07,0x17,0xC5,0x71,0x34,0x13,0xC0,0x0E,0x83,0x08,0x28,0x89,0xFD,0x5B,0x3F,0xE5,0x2A,0x34,0x6E,0x2B,0xEE,0x7C,0xA4,0x64,0x0C,0x07,0xB0,0x8F,0xCB,0x4D,0x2E,0xE6,0x3B,0xDF,0x90,0x70,0xE7,0xB1,0xDC,0x8E},
+    {0x3B,0xD1,0xD7,0xC9,0xCA,0xEA,0x8C,0xF2,0xB2,0x39,0x9F,0x87,0xE5,0x5B,0xC1,0xC1,0xC4,0x73,0xB2,0x0D,0x96,0x0C,0x89,0xF6,0x41,0x92,0x12,0xE3,0x33,0xE0,0x7E,0xB8,0x25,0x62,0xEE,0x53,0x69,0x10,0xAF,0x78,0x94,0xA4,0xAE,0x48,0x88,0x2E,0x9E,0x20,0xAD,0xC2,0x88,0x5C,0x8E,0x45,0xBF,0x01,0xAD,0x85,0xB5,0x8D,0x76,0xF3,0xE5,0xB6,0x0E,0x39,0xD6,0x75,0x7C,0x2E,0xD3,0x24,0xD7,0x81,0x9F,0x66,0x71,0xE2,0x08,0x14,0x2A,0xB9,0xBB,0xD3,0x37,0x2F,0xE6,0xCE,0x5C,0x5D,0xAB,0x2B,0xC5,0xC8,0x1B,0x26,0xBB,0x12,0x95,0x7F,0x98,0x01,0xA8,0x0A,0x6C,0xB2,0x2F,0x09,0xB2,0x8E,0x5B,0xFE,0x43,0x8D,0x81,0x39,0x39,0x92,0x0D,0xAC,0x48,0x8A,0x69,0x2D,0x96,0x74,0x6F,0x4F,0x91,0x07,0x27,0x76,0xE7,0x24,0xD8,0xDD,0xF4,0x91,0xA8,0x08,0x70,0x03,0x00,0xCC,0xDC,0xA4,0xB4,0xD2,0x98,0xF4,0x2E,0x97,0x61,0x95,0x33,0x8A,0x1D,0xFE,0x6E,0xAD,0xBE,0x2A,0x3B,0xF7,0x98,0xAD,0x91,0x0E,0x35,0x8B,0xBE,0x82,0x27,0x0C,0x11,0x70,0x48,0x8D,0x48,0xF8,0xA2,0x00,0x6C,0xF1,0x9D,0x90,0x82,0xEC,0x01,0x48,0x92,0x8F,0x48,0x20,0xE4,0x88,0x60,0x03,0x8A,0x1A,0xB9,0xF4,0x3B,0x7C,0x75,0xA8,0x23,0xA7,0xB1,0xE2,0x02,0xA2,0x91,0xD5,0x26,0xCB,0xF6,0xDE,0x80,0xB9,0xF4,0x4C,0xD2,0x71,0x23,0x9F,0x39,0x79,0xA6,0x08,0xA5,0x79,0xF0,0xE9,0xFD,0xFB,0xEA,0x47,0x47,0x9E,0xE1,0x7D,0x92,0xF3,0x5D,0xB1,0x40,0x18,0xAA,0x3D},
+    {0xB1,0x61,0xC2,0xF8,0x77,0x95,0x29,0xAA,0x23,0x13,0x9D,0x3D,0xE9,0x82,0xC8,0x10,0x2B,0x29,0xB9,0xC5,0xEB,0x11,0x75,0x5F,0x4F,0xCA,0x55,0xA1,0x6A,0x3B,0x9E,0xD4,0x3B,0xB4,0xBE,0xC5,0x7C,0x91,0xEA,0x9D,0xA2,0x41,0xAB,0x73,0x8A,0xC4,0x82,0x79,0xFF,0x94,0x7D,0xCE,0x45,0x9A,0xB1,0x0C,0x5B,0xC7,0x7C,0xA5,0xA1,0x29,0x4F,0x18,0xAE,0xC9,0x33,0x6D,0x8C,0x96,0xED,0x59,0xB6,0xD2,0x30,0x85,0xB7,0x44,0xEE,0x55,0x25,0x6B,0xF0,0x5E,0x74,0xF6,0x2B,0xBE,0x6B,0xCE,0x8B,0x03,0x9D,0x5F,0xAF,0xDB,0x18,0x33,0x10,0x29,0x7C,0xE7,0xFF,0xDB,0xA8,0x0F,0x9D,0x08,0x50,0xDB,0xD0,0x12,0x88,0xC5,0xD7,0xDF,0x1A,0x8E,0x5E,0xC5,0x0A,0xF6,0x8C,0x0E,0x2D,0xF2,0xAD,0x92,0x50,0x3A,0xC2,0x9E,0xFA,0xBA,0x2C,0xD2,0x8F,0x0A,0xEE,0x87,0xF2,0x80,0x70,0xBD,0x6E,0x0B,0x80,0x0A,0x79,0x06,0xF2,0xEE,0x87,0x04,0x47,0xE4,0x98,0x76,0x40,0x10,0xAC,0x96,0xFA,0x49,0xD0,0x1E,0xD5,0xF2,0xF3,0x32,0x3B,0x31,0x70,0x58,0x37,0x83,0x04,0xA8,0x17,0xBD,0x26,0x89,0xE5,0xB1,0x56,0x52,0xD4,0xFC,0xA1,0xFC,0x29,0x33,0xD1,0xF1,0x52,0xA7,0x55,0x63,0x97,0x8F,0xCC,0x33,0x53,0x96,0x86,0x5C,0xDF,0x93,0xFF,0x69,0x54,0xF7,0x6A,0x96,0xA7,0x62,0xFA,0xCC,0x5D,0xA3,0x38,0xCD,0x05,0x19,0x15,0xE0,0x81,0xA5,0x08,0x38,0x10,0x2A,0xD9,0x6A,0xA5,0xC2,0xF3,0x70,0xF5,0x56,0x43,0x5E,0x28,0x86,0xF2,0x21,0xA6,0x26,0x38,0x69},
+    {0x50,0x00,0x80,0x4F,0x93,0x76,0x52,0x5D,0x29,0xDC,0xE7,0x15,0x46,0xEC,0x94,0x17,0x69,0x1D,0xC1,0x5F,0x16,0x82,0x3C,0x4C,0x48,0x0B,0x95,0x20,0xED,0xE4,0x45,0xC2,0x10,0x22,0xD2,0x63,0x6D,0x92,0x5E,0x82,0x22,0xF5,0xB8,0x24,0x89,0xC7,0x9A,0x1B,0x74,0xA8,0x78,0xFE,0xEA,0x42,0xF8,0x0E,0x45,0x9B,0x9C,0x83,0x4D,0xB7,0xF3,0xA6,0xA3,0x52,0xD5,0xC0,0x6F,0x13,0x0A,0x20,0x16,0x93,0x92,0xD9,0xB7,0x9C,0x75,0xF7,0x1C,0x8C,0xCE,0x0E,0x04,0x52,0x24,0x02,0xD2,0xDE,0x4A,0x0B,0x9D,0x81,0xE9,0x7F,0xC5,0xC0,0x72,0xDC,0xFF,0xBF,0xDC,0x71,0x8E,0xD1,0x1C,0x11,0x8F,0x28,0xEE,0x37,0x24,0xFD,0x39,0x67,0xED,0x85,0xC1,0xDD,0x19,0xE6,0x1F,0xE4,0x7B,0xD0,0x7B,0xEB,0x82,0x64,0xCE,0xCF,0x77,0xB1,0x9E,0xF2,0x95,0x74,0xBC,0xE7,0x89,0x07,0x57,0xD9,0x1A,0x7F,0xA1,0x8C,0xC1,0x71,0x92,0x3B,0xE1,0xF9,0x88,0xA7,0xA4,0x91,0xA4,0x26,0xEF,0xD3,0x40,0x3D,0xAA,0x44,0x7B,0x51,0x2F,0x52,0x7F,0x5F,0xFD,0xA0,0x18,0x5F,0xC6,0xA6,0x41,0x95,0x67,0xBC,0x15,0xF7,0x4F,0xBC,0xEC,0xAC,0xB2,0xBC,0x43,0x42,0xDA,0xF0,0x4C,0x4F,0x0E,0x50,0x04,0x26,0x66,0xFB,0x05,0xCB,0x94,0x6A,0x09,0xF5,0xBD,0x78,0x36,0x38,0xAE,0x21,0xF8,0x91,0xD1,0x4F,0xCE,0xC6,0x8C,0x69,0xDD,0x64,0xDB,0x12,0x4C,0x19,0xE1,0x4C,0x72,0x5B,0xC6,0xD2,0xC7,0x9A,0x77,0x3A,0x06,0x65,0xB0,0x00,0x36,0xB3,0xFC,0x06,0x4B,0x91,0x9E,0xED},
+    {0xDB,0xFE,0xE1,0x1D,0xBA,0x31,0x79,0x4D,0x53,0x12,0x63,0x8D,0xCC,0xEE,0xCE,0x6D,0x9D,0xF2,0x79,0x15,0x45,0xA3,0xCC,0x5C,0x60,0x92,0xBB,0x21,0xB1,0x51,0xE7,0xCB,0x35,0xE8,0x94,0x89,0x98,0x60,0xAD,0x49,0xD2,0xD4,0x50,0x5E,0x73,0x29,0x21,0x24,0x90,0xC8,0x10,0xD8,0x3E,0x44,0x22,0x45,0x4E,0xD8,0x3D,0x6B,0xFE,0x81,0x7E,0xA2,0x78,0xFF,0xB8,0x18,0x9C,0x6A,0x93,0xC8,0xD2,0x1F,0x25,0xBD,0xDE,0xC8,0x10,0xD8,0xB9,0xF9,0x9A,0x0C,0x2E,0x05,0xA5,0xB3,0xA6,0x00,0x52,0x91,0x4F,0x92,0xFE,0x65,0x4C,0x65,0xE6,0x4D,0xFE,0x2D,0xE2,0x04,0x3D,0x2F,0x69,0x09,0x6E,0xEE,0x94,0x80,0x82,0xF9,0x2D,0xF1,0x1E,0xF8,0xC9,0x8E,0x08,0x1C,0x8D,0x61,0xDB,0x78,0xE5,0x87,0x61,0x5C,0xB0,0xEF,0xF2,0xF1,0x53,0x4D,0x2A,0x38,0x01,0x06,0x27,0x85,0xEC,0x14,0x8B,0x3F,0x46,0x3E,0x7D,0x25,0x12,0x37,0x5E,0xF9,0x36,0x93,0xEA,0xE3,0x34,0x9A,0x70,0x2B,0xEB,0x68,0x7B,0xD4,0x63,0x23,0xCE,0x56,0x62,0x4B,0xF1,0x9C,0x85,0x09,0x78,0x75,0xD2,0x5A,0x86,0xB3,0x56,0x4F,0x19,0x08,0x7B,0xCD,0x01,0x6D,0x1C,0xE6,0x3F,0xFF,0x65,0x70,0x10,0x31,0x62,0x9E,0xC5,0x4A,0xDF,0x11,0xB2,0xE8,0x61,0x4A,0xFE,0x1B,0xF8,0x62,0x55,0x6C,0x07,0x84,0x4E,0x54,0xD9,0x2D,0x16,0x7A,0xAC,0x03,0xED,0xD3,0x90,0x7D,0xC5,0x9E,0xC1,0xA8,0x46,0x7C,0x9B,0xB4,0x06,0x87,0x81,0x66,0x7F,0x59,0x2F,0x10,0x57,0x87,0x22,0x73,0x78,0x9B},
+    {0x54,0x87,0xC8,0x03,0x32,0x1B,0x3F,0x00,0xAA,0x34,0xEE,0x4D,0xD9,0x7C,0x3D,0xAD,0x61,0xEB,0x3C,0x8B,0x26,0x04,0x26,0x4D,0xF9,0xC9,0xEF,0x56,0x66,0x77,0xB0,0xFA,0xEE,0x94,0x40,0xE3,0x22,0x2B,0x89,0x75,0x82,0xA2,0x77,0x23,0x92,0xDD,0x15,0xEB,0xEE,0x8C,0xCE,0x0F,0xF0,0x65,0x1F,0x46,0xEA,0x74,0xDC,0x4D,0xFB,0xD5,0x61,0x74,0xAA,0x8D,0x4F,0x07,0x99,0x8A,0x81,0x5F,0x66,0x9F,0xA4,0x53,0xA9,0x9A,0x1A,0x7B,0x42,0x9F,0x21,0x4E,0xFB,0x48,0x6B,0xE4,0xF2,0x16,0x23,0xB0,0x45,0x69,0x92,0xEC,0x14,0xFD,0x2E,0xF0,0xE5,0x5C,0x04,0xF8,0x4D,0x05,0x69,0x8F,0xEB,0x15,0x86,0x8B,0xE0,0x05,0x1B,0xF6,0xC6,0x1B,0xBC,0xD6,0x1F,0x91,0x9A,0x3E,0x9E,0x0C,0x93,0x0A,0x1B,0x96,0xB5,0x19,0x6C,0x53,0xC3,0x27,0x7D,0x5E,0xE3,0x7D,0xDD,0x79,0x19,0x06,0x05,0x85,0x92,0xCD,0x10,0x42,0x33,0xFB,0xDA,0xB2,0xE7,0x23,0x4C,0xAB,0x72,0xD2,0x5C,0xFD,0x07,0xB1,0x5A,0x8E,0x7F,0xBC,0xDA,0x59,0x21,0x2F,0x1E,0x85,0xCD,0x31,0xCC,0x1C,0x84,0xDC,0xB2,0x7A,0x09,0x25,0x08,0xCE,0x80,0x02,0x96,0x9F,0xAC,0x8D,0x17,0x3F,0x75,0xC0,0x5B,0x07,0xBA,0xE5,0x5A,0xFF,0x43,0xB0,0xC1,0x55,0x22,0xEC,0x57,0xB0,0x4F,0xF0,0x16,0xC3,0x81,0x74,0xC8,0xC7,0x0D,0xB0,0x41,0x7B,0x89,0xAC,0x7F,0x3A,0xC1,0x30,0x6E,0x0A,0x60,0xB5,0xEA,0xDB,0xE2,0xF5,0x1B,0x3F,0xA8,0x31,0x01,0xEF,0x52,0x36,0x11,0x47,0x5A,0x91,0x25,0x60},
+    {0xFE,0x8F,0x6E,0x23,0x75,0xF6,0xA0,0x86,0xF8,0xEA,0xD6,0xDB,0xEA,0x2A,0x53,0x63,0xE2,0x50,0x5B,0x2B,0x9C,0x84,0x1A,0x01,0x2E,0x6B,0xFE,0xB6,0xD9,0xB0,0xF3,0xA5,0xB9,0xE5,0x3E,0x1B,0xE5,0xF0,0xB5,0x31,0xF9,0xC7,0xE5,0x7C,0xAB,0x84,0xBB,0x63,0x66,0xC1,0x1A,0x95,0x4F,0x22,0x35,0x53,0x05,0x10,0xA3,0x96,0x24,0x51,0x8B,0xBF,0xA7,0xDE,0xF2,0xC0,0x0F,0x47,0x99,0xA4,0x52,0x5D,0x6C,0xBD,0x20,0x67,0xE9,0x3D,0x90,0x14,0x9D,0x93,0xD5,0x7E,0x8C,0x51,0xD3,0xF1,0x6D,0x5A,0x73,0x8F,0xFA,0x32,0x22,0x76,0x55,0x4B,0x31,0x82,0x5E,0xAF,0x35,0x9A,0x01,0x7D,0x68,0x1E,0x20,0x95,0xDD,0x9A,0x5D,0x5A,0x25,0x18,0xB6,0x1E,0x66,0xB7,0x95,0xD3,0x54,0xA5,0x77,0x0C,0x4C,0xC0,0xAA,0xB3,0x7B,0x40,0x1B,0xE3,0x02,0xC0,0x77,0xE2,0x64,0xF3,0x4C,0x46,0x94,0x8F,0x4B,0x91,0xD2,0xC1,0xDB,0x6C,0xF3,0xD7,0x09,0xA2,0x2A,0xF3,0x09,0xD9,0xA3,0xF0,0x5B,0x8E,0x67,0x3B,0xF8,0xBF,0xD4,0xDA,0x5E,0x3D,0xBB,0x41,0x31,0x37,0xE6,0xAD,0x51,0x68,0x02,0x66,0x23,0x06,0x93,0x16,0x26,0xB2,0xBE,0x9A,0xA7,0x46,0xB5,0x6C,0x40,0x7B,0x91,0x4E,0xD2,0x13,0xF4,0xA0,0xC4,0x7E,0xB8,0xE6,0x96,0xDB,0x42,0x47,0xAD,0xBA,0x7C,0x70,0xDD,0xF7,0x4A,0xB8,0x33,0x43,0x6D,0x53,0x7D,0xC0,0x30,0x0C,0x06,0xF2,0xAE,0x12,0x4B,0xD5,0x64,0x68,0xE6,0x21,0x06,0x7C,0x30,0xB5,0x26,0xCE,0xF5,0xBD,0xFD,0x1E,0x56,0x1C,0x6E,0xAC},
+    {0x97,0x08,0x4F,0x8A,0xD7,0x12,0x46,0x77,0xBA,0xFE,0x60,0x68,0x0A,0x8F,0x94,0x69,0x82,0xF2,0x1B,0xEF,0x06,0x99,0x51,0x55,0x00,0xE5,0xEA,0x4D,0xCB,0x6D,0x86,0xE2,0x8B,0xA2,0xB6,0xA9,0xC0,0x55,0x89,0x19,0x88,0xDE,0x89,0x01,0xB6,0xC3,0x82,0x94,0x51,0x9F,0x40,0xE8,0x57,0x48,0xBB,0x14,0x07,0x54,0xB7,0x3E,0xDB,0x15,0xBE,0x5A,0x57,0x9A,0x0A,0x5C,0x45,0x0B,0xFF,0xE1,0x0D,0xA4,0xE2,0xB9,0x4B,0x40,0x8B,0x18,0x32,0x80,0xD3,0x61,0x4A,0xE0,0xAE,0x9D,0x95,0x22,0xAF,0xAF,0x07,0x7D,0x3C,0x0F,0x89,0x22,0x15,0x85,0xF4,0x86,0xAC,0xFF,0x9C,0x2D,0x7F,0x21,0xE7,0xFD,0xA3,0x10,0x6B,0x3D,0x20,0xC9,0xDD,0x0A,0x90,0xA0,0x9F,0x49,0xE5,0x36,0xBE,0x1B,0x46,0xEE,0x2A,0xBE,0xFE,0xD0,0xFD,0x8A,0xB9,0x7E,0x75,0xC6,0xBA,0xEA,0xDD,0x60,0xF5,0x7B,0x9D,0x8D,0x1E,0xD5,0x51,0xAD,0x33,0x8F,0xCC,0xC2,0x75,0x2D,0xF3,0x2C,0x31,0xBD,0x1C,0x7C,0x5B,0xC2,0xE8,0xA1,0x88,0x0D,0xE6,0xEF,0x1B,0x92,0x39,0xAB,0x36,0x31,0x11,0x10,0xCB,0x83,0x9C,0x24,0x8C,0x45,0x9A,0x34,0xF7,0xD6,0xB7,0x5F,0x99,0xF3,0xAC,0xB3,0x1B,0xF1,0xC2,0x9C,0x81,0xB1,0xBC,0xE1,0xE7,0xB7,0xAA,0xB9,0x8F,0xBE,0xCB,0xC2,0x09,0x1E,0x0D,0xE1,0x01,0xA5,0x09,0xE0,0x17,0xF4,0x93,0x9D,0x25,0x3B,0x18,0x76,0xD9,0x4A,0xEC,0xCC,0x0E,0xC4,0x08,0xB2,0xFB,0xE1,0x1B,0x51,0x0F,0xB8,0x80,0x14,0x85,0xD0,0x66,0xE8,0xBF,0x05,0xB2,0xEB},
+    {0xE8,0x91,0x67,0xD6,0x1D,0x28,0x92,0xA1,0xF3,0x27,0x65,0x53,0x15,0x83,0x7F,0x08,0x5A,0xE1,0x0E,0x48,0xA7,0x6F,0x80,0xE8,0x86,0x6B,0x73,0x47,0x3F,0x4E,0x78,0x10,0x83,0xB3,0xD5,0x37,0x19,0x89,0xAA,0x36,0xDE,0x80,0xF0,0xDC,0xD3,0x42,0xB8,0x85,0x25,0x04,0x7C,0x2D,0x91,0x02,0x73,0x59,0xE8,0x56,0xC7,0x5A,0xD4,0x7B,0x44,0xB7,0x61,0x0E,0x3B,0xA3,0x7D,0x7C,0x7C,0x7D,0x35,0x15,0x34,0xA3,0x4B,0xA0,0xE7,0xEF,0x7B,0x51,0x71,0xA2,0xCC,0xDE,0x14,0xD1,0x9D,0x8C,0xA6,0x7C,0x25,0x53,0xD0,0xCE,0xC0,0x97,0xE4,0x40,0x16,0x27,0x42,0x48,0xED,0x40,0x13,0x16,0xEF,0x5F,0x68,0x58,0xC6,0xD7,0x06,0xB5,0xE6,0xF8,0xC8,0x67,0xB9,0x1C,0x14,0x7B,0xBF,0xDA,0x11,0x31,0xD7,0x1B,0x08,0x38,0xBA,0x92,0x7F,0xF5,0xF7,0xCE,0x11,0x38,0xD7,0x56,0xFA,0x73,0x68,0x68,0x15,0x31,0x05,0xA2,0x93,0x06,0x42,0x67,0x73,0x92,0x39,0x82,0x6B,0x7A,0x43,0xFB,0xA2,0xF8,0x16,0x2A,0xD0,0x50,0xF9,0x22,0x0D,0x32,0xBC,0xFC,0x99,0x65,0x7C,0x8D,0x65,0x6B,0xF8,0x59,0x30,0x6A,0x2A,0x4C,0xAE,0xF8,0xFF,0x72,0x74,0x1F,0xBE,0xDC,0x26,0xFE,0x43,0xBC,0xB4,0x56,0xE9,0x23,0xF3,0x7C,0x2B,0x82,0x0E,0x31,0x4D,0x2D,0x56,0xEA,0x8D,0xCA,0xDF,0x71,0xD1,0x09,0x45,0xAA,0xAC,0x7B,0xF9,0xF6,0x8B,0x11,0xF8,0x75,0xF6,0x5F,0x56,0x6A,0xB8,0x20,0x03,0xF9,0x2A,0xC9,0xA4,0x61,0x86,0xD2,0x54,0x22,0x49,0x9F,0x45,0x7F,0x8F,0x7A},
+    {0x5D,0xA1,0x2D,0xAA,0x73,0xE6,0xB1,0xF4,0x4E,0xC1,0xD4,0xD4,0x19,0x80,0x1E,0x33,0xE5,0xF6,0x11,0x91,0x9D,0x78,0xEE,0x8A,0x60,0xF3,0xB0,0xE4,0x15,0x38,0x99,0x3A,0xB3,0x4B,0x6E,0x27,0xE2,0xA0,0x7B,0xCA,0x4F,0x3E,0x05,0x45,0xC4,0x58,0x40,0xF8,0x9D,0xA0,0x5F,0xC7,0xBC,0x54,0x33,0x7B,0x9C,0xA0,0x84,0x6B,0x8D,0x64,0x60,0x56,0x0C,0x62,0x22,0x17,0x6C,0xD4,0x13,0x5A,0xD4,0xE0,0x4E,0x6F,0x8D,0x54,0x36,0x46,0x2C,0xFA,0x2E,0x4F,0x24,0x74,0xA6,0xDF,0xEF,0xDD,0xC5,0x39,0x9C,0xF2,0x1F,0x05,0xBE,0xF4,0xE8,0xBF,0xFA,0x9D,0x98,0x51,0x0E,0xA5,0x89,0x94,0x82,0x2E,0xA4,0x67,0x62,0x6E,0x75,0x94,0x22,0xDC,0x1C,0xBA,0x04,0xAC,0xDB,0x2B,0x29,0x0F,0x9F,0x83,0xA6,0xE8,0xA8,0xD4,0x19,0x94,0xF4,0x3E,0xFD,0x09,0xF2,0xCA,0xF1,0x5B,0xBA,0x84,0xE5,0x06,0x3C,0xCB,0x3D,0x02,0xEE,0x8D,0xA2,0x04,0x77,0xED,0xAE,0xDF,0x15,0xAB,0x8A,0xBB,0x1E,0xD1,0x12,0x2C,0xA4,0x95,0xF5,0x20,0x3B,0x65,0x63,0x10,0xEE,0xB1,0x6C,0x01,0x6F,0x8B,0xA2,0x35,0x78,0xF6,0x5B,0x21,0x95,0x31,0xA1,0x8F,0xE6,0x5B,0x02,0x3F,0x3B,0x25,0x6C,0x84,0x51,0x19,0x4E,0x40,0xA2,0x5A,0x8D,0xFC,0xD6,0x01,0x3E,0x8E,0xE5,0x4D,0x6F,0x8D,0x70,0x2D,0x56,0x44,0x7A,0x90,0xB3,0x25,0x0E,0xE4,0x03,0x82,0x13,0x32,0xC9,0xC6,0xCD,0xA7,0xD7,0x60,0x57,0xED,0x44,0x5B,0xA1,0xD6,0x76,0x3A,0x20,0xFA,0x14,0x2C,0x10,0x55,0x93,0xFD},
+    {0xEF,0x79,0x72,0x95,0x72,0x97,0xEF,0xBF,0x35,0x6C,0xD4,0x8B,0xDC,0x04,0xC6,0xF3,0xF3,0x84,0xCF,0xE7,0x2E,0xF3,0xA0,0x4F,0xBD,0x55,0x50,0xE0,0x89,0xB7,0xD7,0xE2,0x8B,0x55,0x21,0x30,0x19,0x5E,0x3D,0x81,0x91,0xCF,0x10,0x39,0x81,0x52,0x82,0xCA,0x42,0x21,0xE0,0xD2,0x7F,0xEF,0xF4,0xC4,0x8E,0x62,0x47,0x90,0x9B,0xB1,0x66,0x77,0x6C,0x8B,0x06,0x0A,0x32,0xF4,0xFF,0x2D,0xB8,0x77,0xEC,0xD9,0x2E,0xD8,0xE2,0xA1,0x6A,0x73,0x52,0xE6,0x30,0x20,0x0C,0x46,0xCA,0xEF,0x91,0x6F,0xAA,0xAB,0x9E,0x8B,0x19,0x09,0xAD,0x2C,0xC5,0x92,0x82,0xCA,0xC4,0x1F,0x41,0x9F,0x0D,0xA5,0xDF,0x73,0xC9,0x10,0xAF,0x38,0xA0,0x2C,0x2F,0x49,0xD2,0xCA,0x70,0xFF,0xAC,0xB2,0xB1,0x98,0x66,0xE6,0x0F,0x2C,0x9F,0xA6,0xDA,0xAB,0xFE,0x50,0x8D,0x67,0xF8,0x7F,0x4D,0xF9,0x6A,0x1C,0x32,0x65,0xDE,0x65,0xA2,0xDD,0x33,0x4F,0x39,0x73,0xB4,0x12,0xEE,0x9E,0x46,0xDB,0x8B,0x03,0xFB,0xA3,0x2C,0x59,0x38,0x2D,0x37,0xDC,0x32,0x2F,0x93,0x3A,0x83,0xA6,0xAC,0xA0,0x64,0x34,0xD6,0xF4,0x95,0x93,0x25,0x57,0xA1,0x88,0x50,0xE1,0xCB,0x72,0xB3,0x55,0xD6,0x7D,0x52,0xD8,0x3D,0x95,0x4C,0xC5,0x38,0x43,0x16,0x32,0x3C,0xD9,0xC1,0xFE,0x8A,0xE1,0x63,0x2C,0x36,0x80,0xDD,0x6F,0x00,0x1B,0xE8,0x30,0x12,0xD5,0x86,0x4C,0xC3,0x68,0x64,0x7F,0x32,0xD4,0x34,0xF8,0x93,0x8C,0x0E,0x1C,0x2C,0x67,0x09,0x0E,0x6E,0xE2,0xB7,0x00,0xA7,0x14},
+    {0x63,0x6D,0x0B,0x48,0x19,0x86,0x6D,0x25,0x25,0xBE,0x52,0x10,0x19,0x2F,0x05,0x36,0xDB,0x19,0xFA,0x8C,0xE1,0x5B,0x95,0x1B,0x46,0x4C,0x18,0x3E,0xDA,0x84,0xB3,0xEE,0x68,0xA9,0x6E,0xBC,0x79,0x47,0xEB,0x51,0x5E,0xC0,0xAB,0x0C,0x47,0x7B,0xD2,0x09,0xA2,0x61,0x57,0x4B,0x19,0xC6,0xC5,0x16,0x00,0x57,0x96,0x37,0x19,0x9A,0x37,0x12,0x01,0x53,0x01,0xC8,0x5E,0x33,0x90,0x3A,0xC5,0xBE,0xF5,0x32,0xBB,0xE7,0x31,0x11,0xA5,0x86,0x58,0x12,0x3D,0xD2,0x12,0x5B,0xB4,0xBC,0x16,0xE5,0x2D,0x91,0x77,0xD5,0x50,0xFE,0x84,0x57,0x2A,0x62,0x79,0x90,0x2D,0x30,0x6A,0x93,0x4B,0x98,0x39,0x75,0x84,0x40,0x3C,0x4E,0x88,0x94,0xB4,0x22,0x65,0xA8,0x27,0xC9,0x06,0x8E,0xA7,0x52,0x3B,0xF6,0x24,0xA0,0xB4,0x46,0x59,0xCB,0xF4,0x16,0x14,0x45,0xD8,0xF5,0x35,0xA9,0xE1,0xB8,0xD5,0x52,0xDD,0xE3,0xF3,0xAC,0x17,0x1D,0x55,0xAE,0x36,0x8E,0x32,0xF6,0x47,0xC9,0xA7,0x7E,0x60,0x56,0x71,0xDC,0xF9,0xFA,0xCE,0x52,0x6A,0x46,0x60,0x00,0x05,0x21,0x0D,0x20,0x09,0xC8,0xFD,0x11,0xC8,0x32,0xAE,0xB5,0xE1,0x26,0x14,0x5A,0xBB,0x5C,0xDA,0x5E,0x11,0x96,0xB1,0x32,0xFD,0x64,0x18,0xD1,0xF1,0x6F,0x25,0x39,0x31,0xEE,0x4B,0xB5,0x35,0xCF,0x17,0xC2,0xA4,0xBA,0x26,0x72,0xD0,0xF3,0xD4,0x97,0xCC,0xA3,0x5E,0xBC,0x16,0xF5,0x94,0xDA,0xA5,0x8F,0x77,0x57,0x80,0xE2,0x84,0x07,0x24,0x54,0x89,0xBF,0x03,0x86,0xC9,0xE5,0x16,0x8B},
+    {0xE0,0xF4,0x16,0x09,0x6B,0x58,0x01,0x14,0x9D,0x85,0x4C,0xC8,0x76,0xE5,0xF2,0x47,0xD9,0x0C,0x31,0xDB,0x60,0x24,0xC1,0x3B,0xB9,0x7F,0x44,0x6F,0xA7,0x93,0x96,0xEB,0xC2,0xD7,0x89,0x94,0xC5,0x3B,0xB4,0xF7,0x4D,0x67,0xAC,0x3A,0xA2,0xF2,0xD9,0x63,0x26,0x71,0x73,0xD4,0x59,0x7A,0x0E,0x5E,0x9E,0x61,0x89,0xB3,0x1A,0xCD,0x52,0x51,0xC5,0x40,0x49,0x48,0xB2,0x69,0x05,0x6C,0x3E,0xA1,0x7F,0x46,0x75,0x42,0x6F,0x84,0x6A,0x00,0x9D,0xF6,0x62,0x37,0xD3,0xD5,0x62,0x90,0xE5,0x0D,0x15,0x88,0x5D,0x54,0x00,0xC4,0x4C,0x9E,0xB4,0xF3,0xC0,0x41,0x43,0xBB,0x56,0xA0,0x6C,0x2E,0xCC,0x9E,0xF8,0x7C,0xF5,0xE8,0xF3,0x81,0xDC,0x8F,0x35,0xED,0x31,0x5F,0xB4,0x73,0x7E,0xCC,0xF5,0x95,0x23,0xE4,0xA9,0x3F,0x2F,0x47,0x3F,0xCE,0xAD,0x7E,0xBC,0x3A,0xC2,0x63,0x41,0x4F,0x53,0xCF,0xD6,0x29,0xE1,0x40,0x8D,0x58,0x4F,0xB2,0x1B,0x1C,0xDF,0xAE,0x01,0x5A,0xD7,0x3D,0xE4,0x53,0x31,0x43,0x1D,0x17,0x18,0xA1,0x7F,0xC8,0x48,0x98,0xBA,0xD4,0xCC,0xD2,0x2E,0x07,0x1E,0x29,0x46,0x89,0xCB,0x62,0x68,0xE7,0xBB,0x06,0x4F,0xE2,0x38,0xA2,0x00,0xD9,0x4A,0xF0,0x1F,0x60,0x68,0x71,0xF7,0x66,0x2F,0x81,0xD7,0x8F,0x83,0xAD,0xE7,0x74,0x8A,0x59,0xF9,0xDC,0xE0,0x57,0xF2,0xF3,0x55,0xE1,0xC7,0x0F,0x68,0x70,0x70,0xDC,0x06,0x86,0xA7,0x21,0x72,0xC0,0xC7,0x02,0xB1,0x71,0xB2,0xA4,0x0F,0x28,0x2C,0x2F,0x7E,0xA6,0xA2,0xDA},
+    {0xF8,0x0E,0x71,0x4C,0xFA,0x48,0xB1,0x97,0x05,0x7C,0x63,0x40,0xC9,0xA3,0x14,0x79,0xC4,0x2F,0xEE,0xDA,0x24,0xDE,0x09,0xD7,0x26,0xE5,0xFF,0x2C,0x34,0x79,0x71,0x46,0x98,0xA8,0xFD,0x20,0xC1,0xD0,0x62,0x83,0xE0,0xAD,0x14,0x20,0xD1,0xD0,0xFC,0x7D,0x29,0x48,0x8C,0x9C,0x00,0x96,0x3F,0x2F,0x24,0xCA,0x91,0x90,0xB6,0x8D,0x0C,0x68,0xC8,0x40,0xD6,0xEA,0xE0,0xFF,0x9E,0x40,0xF0,0x0A,0x67,0x49,0x0A,0x7F,0x79,0xFB,0xAD,0x7A,0x17,0xA9,0x9B,0x5C,0xE8,0x3B,0xDA,0x61,0x6F,0x8E,0xA1,0xA1,0xDC,0xE5,0x5B,0x22,0x57,0x79,0xB3,0x82,0x85,0xC7,0x47,0x1B,0x3A,0x16,0x5B,0x7F,0xB4,0x77,0xD7,0x69,0x71,0x86,0x29,0x9D,0x3C,0x12,0x7C,0x09,0x26,0xAC,0x33,0xED,0x2D,0x8B,0x75,0xC4,0x59,0x9B,0xD7,0x3D,0x5D,0x8A,0x8C,0x03,0x97,0xF4,0x51,0x81,0x97,0x0E,0x21,0xC1,0xB7,0xEE,0x26,0xA9,0xDA,0xB9,0xCA,0xCB,0x3A,0x8B,0x30,0xD4,0xD1,0xD3,0x03,0x8A,0x38,0x78,0x92,0xFF,0x6A,0x15,0x21,0x0E,0xFD,0x97,0x6E,0x7C,0xAB,0x56,0x4D,0x3C,0x74,0xA1,0x3B,0x67,0xE9,0x86,0xED,0xE8,0xB9,0x80,0x22,0x74,0x11,0x00,0x2D,0xA3,0xD9,0x82,0xA6,0x8C,0x68,0xBB,0x8A,0x09,0xAB,0x38,0x3C,0xAD,0xBC,0x4B,0xB5,0xC3,0x98,0x39,0x53,0x89,0x70,0x83,0xE5,0x3F,0xEA,0xD2,0x5D,0xD8,0x4B,0x3B,0x2A,0x25,0x4C,0xFD,0xA6,0xD9,0xDA,0xF8,0x59,0xFE,0xBA,0x85,0xE8,0xF8,0x37,0xF6,0xBB,0x8F,0xD3,0x55,0x87,0x7B,0x1E,0xFA,0xE4,0x9C},
+    {0xB7,0xF1,0xC7,0xC8,0x75,0x47,0xF1,0x86,0x3A,0xDF,0xD7,0x6D,0x83,0xC7,0x0C,0x1F,0xC1,0xF4,0x81,0xA7,0xBD,0x47,0x92,0xCF,0x98,0xB7,0xC0,0x8D,0xE0,0x74,0x7B,0x65,0xEB,0xCC,0x0E,0x32,0x2A,0xFB,0x6D,0x8A,0x11,0xA1,0x4B,0xD3,0x7E,0xC2,0xBB,0x44,0x95,0x14,0x08,0x32,0x9B,0x01,0x40,0x1A,0x1D,0xC0,0x9F,0x7C,0x97,0x1C,0x2F,0x4E,0xF3,0x93,0x90,0x92,0xE7,0x08,0xD0,0x8D,0x0F,0xD8,0x65,0xAD,0x7A,0x87,0xCE,0x98,0xCB,0x89,0x73,0x65,0x84,0xE4,0xA7,0xFF,0x09,0x56,0xA2,0xCA,0xFA,0xDC,0xBD,0xDF,0xC3,0x08,0x1C,0x73,0x28,0x01,0x16,0x59,0xB4,0xB5,0x84,0x92,0xAE,0x8E,0x64,0x08,0xDF,0x41,0x50,0x86,0xD7,0x4E,0x4C,0x5B,0x0D,0xB6,0xDB,0x33,0x2F,0x8A,0x3A,0x0A,0xB6,0x6D,0xDA,0x27,0x5A,0x54,0xBE,0xA6,0x68,0xDF,0x71,0x38,0xA5,0x7A,0xCE,0x11,0xB0,0x20,0xAF,0x85,0x2E,0xA0,0xE2,0xD7,0x49,0xD0,0x71,0x3A,0x84,0xEC,0xA7,0x6A,0xC1,0x30,0x2A,0xD4,0x0E,0x24,0x6E,0x3A,0x7F,0x19,0xDF,0x79,0x34,0x49,0x65,0xD5,0xFC,0xB3,0xEF,0x61,0x2F,0x50,0x75,0x03,0xFD,0x97,0x47,0x12,0xEA,0x75,0xF9,0x47,0xE3,0xA3,0x8E,0xB2,0x94,0xD5,0xD9,0x2E,0x8A,0xE4,0x61,0x00,0x56,0xE2,0xB3,0x90,0xDF,0x4F,0x0A,0x51,0x4C,0x95,0x81,0x97,0x4C,0x18,0x30,0x4A,0x4C,0x93,0x27,0xCD,0x72,0x3A,0x12,0x0E,0xDD,0xD1,0x27,0xE6,0xC1,0x9E,0x06,0xDD,0xF6,0xD0,0x2D,0x9F,0xCE,0x8E,0x7E,0xBC,0xBB,0x3F,0x07,0x3C,0xCA,0x78},
+    {0xE8,0xE3,0xB2,0x5D,0x1D,0x63,0x52,0x35,0x87,0x4D,0xCA,0xCE,0x7F,0x9D,0xA9,0xC0,0x95,0x1A,0x09,0x16,0xD3,0xA5,0xB4,0xCA,0x77,0x69,0x11,0xE4,0x14,0xEB,0x93,0xD4,0xC5,0xAB,0x44,0x3A,0xC5,0x19,0xBB,0xA0,0x3F,0xA5,0x25,0x79,0x34,0x75,0xB4,0x6B,0x2A,0x63,0x38,0x26,0x82,0x0D,0x9C,0x0F,0xAD,0x02,0x13,0x13,0xF6,0xEF,0xB6,0x65,0xE1,0xB9,0x57,0xE8,0x54,0xAE,0x21,0x64,0x61,0xA4,0xBD,0xCF,0x22,0x3F,0x03,0x67,0x6E,0x15,0x25,0xE2,0x79,0x3A,0x03,0x54,0xBA,0x98,0xBD,0xF7,0x8A,0xD3,0x51,0x55,0x8D,0x73,0x28,0x5A,0x16,0xD1,0xB6,0xDA,0xA5,0x29,0x2E,0x1E,0xD9,0x4A,0x40,0x11,0xC4,0xBB,0x20,0xB1,0x45,0x2F,0xB1,0x95,0x86,0xB9,0xBD,0xBF,0x1B,0xE6,0x18,0x7C,0x5E,0x2B,0x93,0x14,0xA5,0x50,0x3B,0x13,0xF4,0x8E,0x79,0x36,0xD3,0xDB,0xE3,0xFC,0xE5,0x8E,0xD5,0x54,0xB0,0x3F,0x6A,0xE9,0x7C,0xBC,0xCD,0xD0,0x8E,0x5A,0x0D,0xD2,0x09,0x7A,0xCD,0x57,0x0B,0x5D,0x56,0x79,0xA6,0x93,0xB3,0xF8,0x89,0x5A,0x0A,0x8C,0x99,0xB1,0x68,0x1F,0x1C,0xAE,0xE2,0xA4,0x68,0x40,0xFB,0xD4,0x90,0x34,0x6A,0x05,0xA8,0xD5,0x8F,0x7E,0x54,0x1E,0x3F,0x96,0xBE,0x7A,0x24,0x1A,0xFC,0xEA,0x3D,0xDC,0xAA,0x19,0x02,0xBA,0x8A,0xAC,0x2D,0x50,0xE5,0xC1,0xD0,0xB6,0x8F,0x1F,0xF8,0x74,0x80,0x4B,0xF3,0xCF,0xAE,0x7B,0x43,0x1F,0x74,0x34,0x5A,0x05,0x9A,0x8E,0xA1,0x9B,0x2C,0x88,0x3C,0xF4,0x50,0xF6,0x31,0xF3,0x4E,0x15},
+    {0x91,0x2C,0xE6,0xC9,0x40,0x7D,0xB9,0xE1,0x87,0x30,0x8D,0xBC,0xF6,0x6F,0xF6,0x43,0x85,0x92,0xC7,0x29,0xD2,0x88,0x96,0xD8,0x2F,0xBD,0x3E,0x9F,0x59,0xF5,0xEC,0x60,0x37,0x2B,0xF6,0x15,0x4B,0xFD,0xF5,0xB7,0xE8,0x39,0x19,0x43,0x56,0x86,0x5A,0x9B,0x47,0x29,0xDE,0xD3,0x84,0x2B,0x8E,0xBB,0x86,0xD9,0xE4,0xD2,0x76,0x4E,0x70,0x61,0x68,0x4D,0x82,0x54,0x7F,0x95,0xFF,0x5D,0xDC,0xEC,0xA8,0x68,0x0C,0xF2,0xFD,0xB3,0xA9,0x7C,0xB1,0xAC,0x67,0x31,0x75,0xCD,0x5D,0xC3,0x31,0xE0,0x33,0xCD,0x4A,0xC2,0x77,0x45,0x07,0x16,0x7A,0x59,0xB9,0xFE,0x33,0x7A,0x98,0x33,0x08,0xD5,0x1A,0x58,0xFF,0x8D,0xB3,0x7B,0xC4,0x38,0xFC,0xB2,0xCD,0x03,0xF2,0xCE,0x54,0x13,0x38,0x44,0x01,0x49,0x07,0xA0,0x24,0x15,0x69,0x4B,0xEC,0xCC,0xA2,0x44,0x94,0xF2,0x6F,0x0D,0x6E,0x56,0x46,0x64,0xDD,0xFC,0x94,0x30,0x65,0x47,0x73,0xE3,0xBD,0xA6,0x5C,0x14,0x66,0x99,0xD7,0x48,0xA3,0x5A,0x8D,0x00,0x4B,0xEB,0x29,0x33,0x44,0xC6,0x39,0xD8,0xF8,0xC4,0x2E,0x9D,0xF1,0xC5,0xD0,0x51,0xB1,0x0F,0x73,0xCA,0xAE,0xEB,0xBE,0x60,0xC2,0x62,0x51,0x4A,0x6B,0x7A,0x7B,0x16,0xB0,0x58,0x4F,0x08,0xD8,0x9E,0x62,0x2F,0xB1,0xF6,0xA2,0xD0,0x67,0x70,0xE2,0xC5,0xAF,0x4D,0xC6,0xBA,0x18,0xDF,0xB0,0x70,0xA7,0x68,0xAE,0x87,0x2F,0x21,0xE6,0x40,0xC4,0x06,0xD3,0x6A,0xE0,0x16,0x93,0xF9,0x74,0x7A,0xAC,0x07,0x06,0xF5,0x39,0x42,0x40,0x31},
+    {0x95,0xBB,0x79,0xD9,0x17,0x11,0x7C,0xE5,0x5A,0x5A,0x3C,0x4F,0xB7,0x32,0xEF,0x1D,0xE7,0xA6,0x1A,0x3E,0xAB,0xA6,0xC8,0x8A,0x65,0xBD,0xD5,0xC3,0xCD,0xF8,0x45,0xE9,0xD0,0x46,0x80,0x04,0xE8,0x4C,0xF2,0xC9,0xAA,0xFB,0x54,0x3B,0x2F,0x3C,0x33,0x81,0x23,0xEF,0x86,0x50,0x50,0x04,0x73,0x43,0x6A,0x92,0xCE,0x20,0x04,0x9B,0xDF,0x26,0xA6,0x40,0x9D,0x99,0xE6,0x05,0xE7,0x2F,0xF0,0x35,0x22,0x6F,0x0B,0x4A,0x7F,0x84,0xC9,0x1B,0x23,0x52,0x28,0x65,0x22,0x80,0x80,0x5C,0xA3,0xF7,0xD6,0x78,0x39,0xBA,0xDE,0x1E,0x9C,0x41,0xE8,0xC8,0x13,0xDD,0xAB,0x53,0xA7,0xE3,0xB9,0x1E,0x8B,0xE0,0x2B,0x5A,0x9B,0x8D,0xD0,0x73,0x76,0xF6,0x68,0xFA,0xB4,0xFC,0x4F,0x15,0x4A,0x70,0x20,0xDB,0x72,0x2A,0x90,0xF3,0xFA,0x92,0xC4,0x07,0xF5,0xAC,0x8D,0x7F,0x55,0x1C,0x76,0x8C,0x32,0xBE,0xDE,0x2D,0x48,0xFC,0x71,0xBD,0x94,0x33,0xE8,0xFC,0xE5,0x91,0xB0,0x8F,0x30,0x09,0x66,0x64,0x7F,0xCD,0xDD,0xAD,0x8A,0x72,0x78,0x74,0x64,0xD3,0x6A,0xCA,0xA6,0xA8,0x42,0xBB,0xBC,0xF4,0xE8,0xF2,0x63,0x0D,0x74,0x78,0x6A,0xB4,0xF8,0x97,0x01,0x4A,0x6A,0xE1,0x6D,0x6A,0x32,0xAB,0x1D,0x94,0x5C,0x0F,0x6E,0xD1,0x73,0x24,0xF9,0x3E,0xDC,0x5C,0x9E,0xD9,0xA8,0xF3,0x75,0xF7,0xC3,0xAB,0x57,0xD5,0x96,0x59,0x5C,0xD4,0xAC,0xF1,0x68,0xB8,0x3B,0x47,0xB6,0x43,0x55,0x0D,0x0A,0x81,0x7A,0xD9,0x93,0x64,0xA6,0x61,0xD2,0xFC,0x8E,0xEA},
+    {0x97,0x8A,0x09,0xC5,0x25,0xAD,0x39,0xAB,0x59,0x88,0xA7,0x26,0x6D,0xCF,0xBD,0x5A,0xB4,0xE0,0x01,0x4C,0x43,0xD4,0x6F,0x5F,0x0F,0x56,0xA4,0x9E,0x12,0x6B,0x4B,0x65,0x20,0x14,0xE9,0xAB,0x35,0xB3,0x51,0x1B,0x82,0x9D,0x84,0xEC,0x6D,0xAD,0xF7,0xC0,0xB0,0x42,0x21,0x40,0xF6,0x7F,0xDB,0x0D,0xE3,0xCE,0x8C,0x76,0x96,0xDF,0x88,0x47,0x2C,0x4E,0x8E,0x23,0x6F,0x7B,0x36,0x30,0x7E,0xCE,0x75,0xA3,0xF8,0x19,0x94,0x55,0xAE,0xE5,0xAD,0xDF,0xD1,0x8D,0x02,0xCE,0xE6,0xF9,0x4A,0x4D,0xF0,0xAA,0x69,0xDD,0xD5,0x71,0x87,0xE3,0xAD,0xC7,0x3D,0xA9,0xAB,0x60,0x87,0x10,0x94,0x34,0x24,0xBC,0xBF,0xD1,0xF4,0x3C,0x56,0x0E,0xDE,0xD8,0xF7,0x40,0x45,0xDE,0x55,0xB2,0xED,0x70,0xDC,0x98,0x98,0x0C,0xF7,0x67,0x25,0x82,0x87,0x22,0x99,0xE4,0x6D,0x6A,0x27,0x3B,0x1D,0x15,0x7F,0xCA,0xB6,0x7F,0x38,0xED,0x3C,0xEE,0x5B,0x9C,0x2E,0x0F,0x5E,0xF4,0xA4,0xFA,0x68,0x98,0xE6,0xF0,0xD9,0x60,0x8E,0x1C,0xD6,0xF4,0xC0,0xF8,0xBC,0xF1,0xAD,0x03,0xEE,0xE7,0xAB,0x92,0x47,0x8B,0xB9,0x2C,0x7A,0x76,0xDC,0x48,0x8E,0xBE,0x73,0x96,0x2D,0x18,0x6B,0xE8,0xB9,0xA5,0xF8,0x39,0xA7,0xEF,0x73,0x13,0xBD,0xE2,0x17,0x7C,0x99,0xA0,0x27,0x5E,0x27,0x50,0xB0,0x1A,0xFF,0x45,0xCA,0xDB,0x18,0xD6,0xE3,0x43,0x24,0xBA,0x8D,0xFF,0xDD,0x1B,0x3F,0xEA,0x68,0xA7,0xCA,0xF3,0x30,0x0B,0xE5,0xBE,0xC7,0x83,0x94,0xAE,0xBA,0x36,0x03,0xA6},
+    {0xD0,0xD9,0x6F,0x18,0x68,0x57,0xEB,0xC8,0xA2,0xBA,0x98,0x44,0x30,0x74,0xBF,0x6B,0xCB,0x84,0xAB,0xA0,0x3A,0x52,0x9D,0x90,0x49,0x73,0xA5,0x65,0x04,0xB1,0xE6,0x07,0x5A,0xD2,0xAD,0x76,0x4E,0x73,0x66,0xA2,0x5B,0xDD,0xEF,0x74,0xEC,0x11,0x2B,0x4F,0xA6,0xE5,0x2F,0x1F,0x0B,0x79,0x58,0x01,0x17,0x28,0xC5,0x5E,0x41,0xCB,0x56,0xC5,0xEA,0xF2,0x14,0xDF,0x0B,0x29,0xC1,0x85,0x6D,0xA6,0xF3,0xAD,0xB2,0x36,0x50,0x2C,0xE3,0x3C,0xA1,0x5B,0xF1,0xA5,0xD1,0xDA,0x8E,0x06,0x60,0x9E,0x3B,0x48,0x6A,0x97,0x79,0x4F,0x7D,0x2C,0xCF,0xA9,0x6B,0x91,0x3B,0x89,0x11,0x50,0xC3,0x1B,0xFA,0x45,0x3B,0x0C,0xF5,0xDF,0x79,0x37,0x38,0x64,0x07,0x91,0x6C,0xA3,0xDF,0x4E,0xF0,0x76,0xBE,0x60,0x8F,0x27,0x9C,0xA0,0xD2,0x4F,0xBE,0xFD,0xE3,0x96,0x43,0x85,0x74,0x38,0xCC,0x99,0x4E,0xB5,0xE3,0x9A,0x17,0xF8,0xD6,0xDA,0xE5,0xAB,0xF7,0x56,0xF0,0x19,0xB1,0xDE,0x74,0x53,0xDA,0xD5,0x86,0x95,0x9E,0x6E,0x70,0xB5,0xD2,0x94,0x8E,0xC3,0xD7,0xC4,0x1B,0xE1,0x64,0x53,0xE7,0x96,0x66,0x7A,0x94,0x03,0x07,0xDD,0x40,0x9B,0x76,0xF5,0xB7,0xD0,0x55,0xF1,0x67,0x61,0x33,0x88,0x6F,0xD9,0xD5,0x76,0xEF,0xC1,0xDE,0x38,0xE2,0x29,0x4C,0x82,0xE5,0xFF,0x95,0x0D,0x30,0x47,0xC8,0xED,0x37,0x7A,0x16,0x2B,0x31,0x94,0xC3,0xEB,0xB5,0x3F,0x8D,0x5D,0xEC,0xE1,0xC1,0xB0,0x56,0x70,0x1B,0x4A,0x48,0x5E,0x48,0x23,0xDF,0xF1,0x9B,0x7D}
+};
+
+const uint8_t packed_level_vectors[2][250] = {
+    {0x79,0x0F,0x25,0x5A,0x86,0x7B,0x23,0xCC,0xED,0x4A,0xD9,0x54,0xF9,0x5A,0x9E,0xA7,0x39,0xD7,0x51,0xD0,0x13,0x73,0x6A,0x3A,0x7C,0xD5,0xB2,0xB0,0x57,0x60,0x51,0x4A,0xE8,0x17,0x32,0x4C,0x1E,0x7A,0x4A,0x56,0xFC,0xF8,0x92,0x21,0x67,0x63,0x33,0x3D,0x8F,0x54,0xAE,0xA7,0x2E,0x61,0x59,0xD9,0x30,0xA9,0xA1,0xB1,0x35,0x0B,0x62,0x53,0xF5,0xFA,0x06,0x53,0x54,0x47,0xA5,0xA0,0x17,0xB3,0xFF,0xC7,0xCD,0x9D,0xA3,0xD6,0x32,0xBF,0x24,0x47,0x77,0x64,0xA4,0xE6,0xB8,0x9F,0x2F,0x8F,0x98,0x88,0x8B,0xF2,0x09,0x3C,0x9A,0xE3,0x13,0x35,0xE4,0x16,0x79,0x11,0xFB,0x11,0xCE,0x86,0x31,0x68,0x72,0x09,0x08,0xD4,0xCF,0xDB,0xC9,0x05,0xC7,0xC1,0xE2,0xB7,0x1F,0x28,0x46,0x8B,0x13,0xBD,0xFA,0x1A,0x13,0x9A,0x61,0x5E,0xF7,0x73,0x19,0x7F,0xC4,0x15,0x00,0xCF,0x8D,0x3E,0x80,0xC3,0x88,0x91,0x00,0xE0,0x1B,0x72,0x03,0x39,0xDC,0x27,0x12,0xD8,0xE1,0x4B,0xFF,0xEA,0x16,0x2D,0x46,0xF0,0x48,0x26,0x4A,0xEA,0xDB,0xCF,0x69,0x8F,0x57,0x57,0xA2,0x6D,0x48,0xB1,0x80,0xEA,0x13,0xF8,0x3F,0x0E,0xC9,0x38,0x92,0x13,0x2D,0xA7,0x7C,0xCA,0xA2,0xE6,0xF8,0x89,0x9D,0x63,0x7E,0x3F,0xAD,0x4C,0xCE,0x38,0x9F,0x00,0x0D,0x18,0x17,0xE0,0x99,0xE5,0x00,0x1C,0x5A,0xD4,0x7E,0xAC,0x20,0x33,0x97,0x9B,0x06,0xC9,0x8C,0xB5,0xDA,0x2B,0xFF,0x35,0xC5,0xCB,0x9C,0x7C,0x45,0x24,0x9B,0x12,0x4A,0xD0,0x53,0x41,0x96,0x71,0xDE,0x46},
+    {0x58,0x0A,0x3F,0x22,0xCC,0xDB,0x4B,0xFF,0xF2,0x40,0x5F,0x61,0xC2,0x16,0xB7,0x6D,0x28,0x73,0xD0,0x59,0x34,0x5C,0x72,0xFF,0xF5,0x68,0x2A,0x87,0xBA,0xD9,0x11,0xB6,0x18,0x1E,0x90,0xE7,0xB3,0x4A,0x61,0x88,0x99,0x12,0x22,0x76,0x4E,0xD3,0x9B,0xD7,0xA0,0x21,0x2C,0x63,0x12,0x90,0x7C,0xFB,0xB7,0x95,0xAA,0xE1,0xAC,0x01,0xED,0xD6,0x34,0xED,0x2B,0x73,0xC1,0x54,0x11,0x4A,0xA0,0xF7,0xF7,0x5E,0x1A,0x8F,0xA3,0x32,0x3C,0x3E,0x18,0xD9,0xBC,0xFA,0xCB,0xFA,0xB5,0xF8,0x22,0xA8,0xC3,0x62,0x6F,0xEF,0x9F,0x8F,0xCB,0xC5,0xF3,0x92,0x49,0xE0,0xD4,0xAF,0x84,0x64,0x61,0x2D,0xF3,0x1D,0xE8,0x10,0xF8,0x98,0x29,0x41,0xF2,0x83,0xC9,0xF2,0x8E,0x52,0x96,0x95,0x6F,0xB2,0x08,0x8A,0x96,0xD5,0x92,0xFB,0xEC,0x45,0xFE,0xE2,0x2B,0x42,0x1D,0xE0,0xFC,0xFB,0x91,0x24,0x87,0x38,0xA8,0xAF,0x0A,0x4E,0x2E,0xFF,0xFB,0xE0,0xC8,0xA1,0xB8,0x71,0x1F,0xE6,0x2B,0xF9,0x68,0xD4,0x10,0xD5,0xD0,0x64,0x37,0xCC,0x1E,0x78,0x08,0x1E,0x4E,0x6E,0x5B,0xB7,0x44,0xD4,0x13,0xA3,0xDF,0xE1,0xCC,0xE7,0x70,0x0B,0xC4,0x04,0x81,0x25,0x69,0x34,0x5B,0xF8,0xB9,0xCE,0x97,0x8A,0x4A,0xCD,0x05,0x0D,0x39,0xE3,0x5B,0xEC,0x67,0xA2,0x68,0xF5,0x5C,0x8B,0xD0,0x54,0x15,0x1B,0xF3,0x5C,0xA1,0x7C,0xD8,0x5C,0xD9,0x11,0xCC,0x81,0x8C,0x6C,0x72,0x49,0x2C,0xB5,0x38,0xF9,0xF9,0xB5,0xBC,0x11,0x54,0xF4,0xF5,0x25,0xBA,0xAF,0xAF,0xFF}
+};
+
+const uint8_t packed_class_hvs[3][250] = {
+    {0x88,0x26,0xC2,0x93,0xB5,0x0E,0x12,0x7A,0x53,0xEC,0x34,0x40,0x30,0x95,0x02,0xE4,0xD9,0x01,0x70,0x1F,0x04,0x96,0x2A,0x25,0x10,0x24,0x47,0x10,0x62,0x18,0xAA,0x9C,0x20,0xB1,0x86,0x2F,0xFF,0x43,0xE1,0xDD,0x22,0x35,0xA7,0x58,0x84,0x25,0x83,0x54,0x22,0xF0,0x94,0x70,0x12,0x3B,0x82,0xD4,0xBB,0xF9,0x34,0x93,0xC1,0xD2,0x84,0x24,0x56,0x30,0x8B,0x0B,0xB3,0x61,0xB2,0x95,0x66,0x37,0x01,0x68,0x84,0x43,0xD1,0x02,0x18,0xBE,0x1D,0x74,0x23,0x18,0xA4,0x32,0x6A,0x81,0x4C,0x04,0x2C,0x40,0x92,0x6F,0x40,0x0E,0x96,0x8A,0xE5,0xE3,0x6A,0x57,0xD7,0x0A,0xC4,0x03,0x00,0x98,0xB1,0x9C,0xB2,0xD0,0x01,0x21,0xA0,0x50,0x45,0x83,0x4B,0x59,0x37,0x49,0x00,0x12,0x60,0xD8,0x61,0x08,0x60,0x3C,0x2C,0xAE,0x5C,0x08,0x1A,0xED,0xAE,0x99,0x15,0x46,0xC2,0x12,0x69,0xB2,0xDF,0x55,0x59,0x1E,0xBA,0xD5,0x71,0xF8,0x72,0x9A,0x76,0x9D,0x62,0x44,0xC2,0xB1,0x85,0xB3,0x08,0xC3,0x49,0x85,0xBB,0x3C,0x79,0x98,0x6C,0x17,0xE8,0x8E,0x1B,0xF3,0x6D,0xF5,0x2C,0x80,0xE6,0xCB,0x4F,0xEA,0xF1,0x0A,0x79,0x45,0x52,0x70,0x52,0xD1,0x31,0xF8,0xF0,0xAA,0x20,0x93,0x21,0x83,0x15,0x05,0x50,0x06,0xD0,0x82,0x40,0x78,0xCD,0x2A,0x11,0x00,0x1C,0x04,0x70,0x48,0x03,0x32,0x7F,0x57,0x39,0xC8,0x84,0xB0,0x26,0x9D,0x62,0x68,0x14,0x85,0xF7,0x5B,0x77,0x76,0x4E,0x47,0x64,0xD0,0x99,0x48,0x91,0x62,0x03,0x23,0x80,0x03,0x4C,0xAA},
+    {0x88,0x23,0xC0,0x83,0xFD,0x0E,0x32,0x6B,0x58,0xE4,0xB4,0x64,0x02,0x91,0x03,0x26,0xC9,0x85,0x71,0x9F,0x00,0x97,0x2A,0x60,0x11,0x31,0xC7,0x12,0x4E,0xA9,0xAA,0x04,0x00,0xB8,0x86,0x85,0x53,0x63,0xE2,0x0F,0x42,0x3D,0x17,0x49,0x85,0x05,0x2B,0x1C,0x28,0x95,0x16,0x74,0x3A,0x3B,0x86,0xD4,0x3B,0xF1,0x36,0x83,0xC1,0xD0,0x8E,0x21,0x96,0x26,0x8E,0x2B,0x32,0x60,0x02,0x95,0xC1,0x37,0x01,0x60,0x01,0x53,0xD1,0x02,0x1A,0xBE,0x1D,0xF6,0x2A,0x9A,0xA6,0x36,0x6A,0x87,0x40,0x00,0x6D,0x40,0xD2,0x67,0xC2,0x0E,0x96,0xA8,0x25,0xE6,0x46,0x55,0x52,0x2A,0xC4,0x02,0xA5,0x9A,0x31,0xB8,0xB8,0xC1,0x31,0x6D,0x42,0x40,0x45,0x07,0x4B,0x48,0x57,0x48,0x08,0x1E,0x60,0xD8,0x62,0x2A,0x28,0x3A,0xAC,0xEE,0x50,0x09,0x13,0xFD,0x8C,0x99,0x14,0x46,0x22,0x22,0x61,0xB0,0xDF,0xB5,0x59,0x2C,0xBA,0x55,0x74,0x7C,0x42,0x9A,0x62,0x9D,0x6A,0x44,0xC4,0x31,0x05,0xB2,0x36,0x53,0x1D,0xA1,0xA3,0x3C,0x40,0x98,0x28,0x12,0xC8,0x9E,0x12,0xE2,0x24,0x35,0x20,0xA0,0x66,0xC3,0x0B,0xEA,0xE1,0xE2,0xF0,0x54,0x00,0x60,0x72,0x53,0x30,0xA0,0x80,0xAC,0x60,0xD3,0x29,0x03,0x21,0x07,0xD0,0x47,0xD1,0x83,0x80,0x74,0x85,0xAA,0x00,0x04,0x18,0x24,0xA0,0x40,0x0D,0x73,0xFE,0x57,0x38,0x80,0x83,0xB0,0xAA,0x05,0x22,0x68,0x10,0x87,0xF6,0x1B,0x76,0x08,0x4E,0xC7,0xC4,0xC0,0xB9,0x4A,0x9B,0x46,0x05,0x07,0x80,0x17,0x5C,0xBA},
+    {0xA9,0x26,0xC0,0x93,0xF5,0x0E,0x12,0x4A,0x57,0xEC,0x34,0x40,0x10,0x91,0x02,0xA6,0xD9,0x25,0xF0,0x9F,0x25,0xB2,0x32,0x65,0x10,0x2D,0x57,0x35,0x63,0x01,0xAA,0x08,0x60,0xB0,0xA6,0x2F,0xF2,0x43,0xE2,0x0D,0x06,0xB5,0x37,0x49,0xA5,0x85,0xAB,0x14,0x2A,0xD1,0x94,0x70,0x3A,0x2B,0x82,0xD6,0x39,0xC1,0x34,0xC3,0x41,0xD2,0x03,0xA5,0x17,0x34,0x86,0x0B,0x33,0x70,0x26,0xF5,0x41,0x33,0x01,0x60,0x90,0x51,0xD1,0x82,0x18,0xBF,0x3D,0x78,0x21,0x90,0x8E,0x22,0x6B,0xC0,0x48,0x05,0x25,0x00,0xF2,0x77,0x50,0x0C,0xD6,0x88,0xE5,0x60,0x4A,0x37,0x76,0x38,0xC2,0x03,0x24,0xB9,0xB1,0xBC,0xA0,0xC0,0x71,0x21,0xA4,0x40,0x55,0x83,0x4B,0x48,0x7B,0xE9,0x00,0x1E,0x69,0xC1,0x63,0x2D,0x40,0xB4,0xAD,0x8E,0x54,0x18,0x1A,0xED,0xAE,0x99,0x95,0x17,0x62,0x02,0x65,0xBA,0xDF,0x55,0x59,0x14,0xB2,0xD1,0x54,0xF0,0x62,0x92,0x76,0x99,0x42,0x64,0x60,0xB1,0x85,0xB2,0x48,0x9B,0x4D,0xA1,0xBB,0x7C,0x34,0x9C,0x2C,0x03,0xA8,0x1E,0x0B,0xD3,0x65,0xA5,0x2C,0xE0,0xE6,0xC3,0x03,0xE2,0xB0,0x2A,0x71,0x55,0x00,0x70,0x52,0x51,0x31,0x78,0xA8,0xAE,0x20,0x91,0x21,0x82,0x15,0x45,0x58,0x46,0xD1,0x9A,0x00,0x50,0x85,0x08,0x50,0x00,0x9C,0x02,0xF0,0x40,0x08,0x3A,0xF6,0x47,0xB9,0xC0,0x88,0xB0,0x22,0x9D,0x62,0x78,0x10,0x84,0x7A,0x4F,0x57,0x0A,0xEE,0x47,0x44,0xD0,0xBB,0x48,0x9F,0x42,0x81,0x47,0x88,0x45,0x2C,0xBA}
+};
+
+#endif // PACKED_VECTORS_H
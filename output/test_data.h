@@ -0,0 +1,19 @@
+#ifndef TEST_DATA_H
+#define TEST_DATA_H
+
+#include <stdint.h>
+
+#define NUM_TEST_SAMPLES 5
+#define FEATURE_SIZE 784
+
+const uint8_t test_features[NUM_TEST_SAMPLES][FEATURE_SIZE] = {
+    {91, 85, 77, 254, 213, 169, 226, 50, 130, 189, 255, 18, 33, 84, 88, 193, 166, 117, 255, 47, 24, 43, 76, 105, 243, 82, 122, 189, 136, 101, 98, 250, 169, 105, 190, 17, 117, 84, 0, 36, 137, 182, 111, 227, 142, 201, 218, 85, 20, 158, 78, 204, 255, 22, 255, 248, 231, 0, 214, 21, 217, 201, 13, 239, 27, 2, 7, 180, 252, 87, 51, 207, 79, 213, 211, 233, 212, 4, 52, 255, 102, 39, 68, 49, 83, 17, 8, 21, 53, 245, 128, 185, 117, 101, 151, 104, 148, 6, 20, 51, 255, 231, 244, 7, 248, 182, 133, 75, 222, 16, 90, 19, 166, 23, 99, 245, 202, 158, 43, 48, 0, 61, 42, 44, 10, 101, 218, 18, 179, 180, 126, 218, 110, 172, 0, 86, 15, 3, 43, 245, 68, 175, 87, 22, 144, 34, 43, 126, 144, 250, 41, 61, 35, 90, 59, 188, 69, 205, 150, 76, 38, 11, 205, 53, 11, 150, 240, 211, 214, 140, 252, 59, 159, 255, 219, 56, 60, 173, 2, 8, 193, 73, 114, 66, 11, 119, 175, 178, 66, 49, 23, 205, 255, 237, 67, 122, 61, 50, 2, 115, 80, 227, 114, 64, 0, 92, 67, 186, 250, 113, 84, 24, 0, 11, 137, 199, 205, 42, 112, 198, 179, 143, 0, 10, 86, 176, 218, 5, 120, 130, 89, 46, 93, 180, 8, 197, 22, 74, 0, 219, 233, 235, 97, 6, 0, 152, 48, 0, 211, 167, 13, 52, 99, 115, 81, 200, 229, 84, 246, 223, 226, 213, 99, 0, 167, 146, 0, 250, 39, 118, 155, 74, 135, 64, 104, 61, 67, 0, 216, 57, 244, 112, 91, 9, 255, 220, 214, 192, 238, 76, 238, 119, 3, 0, 90, 24, 121, 227, 157, 222, 0, 119, 177, 17, 213, 55, 154, 30, 224, 111, 192, 137, 66, 194, 111, 24, 183, 121, 174, 12, 41, 0, 173, 247, 130, 186, 131, 9, 216, 253, 150, 78, 205, 241, 184, 223, 101, 232, 74, 112, 137, 55, 97, 8, 72, 136, 18, 234, 237, 56, 0, 14, 187, 130, 39, 126, 83, 198, 190, 47, 83, 205, 193, 196, 163, 37, 27, 8, 234, 95, 0, 14, 83, 205, 221, 6, 229, 121, 93, 28, 33, 23, 158, 0, 237, 189, 132, 169, 15, 107, 12, 9, 198, 142, 150, 53, 212, 112, 1, 151, 0, 216, 236, 65, 111, 168, 212, 0, 201, 181, 78, 141, 83, 217, 0, 200, 44, 0, 74, 2, 252, 63, 176, 115, 242, 173, 50, 110, 178, 119, 135, 6, 189, 73, 24, 87, 164, 6, 252, 248, 77, 182, 241, 254, 246, 1, 0, 78, 37, 131, 88, 188, 89, 173, 219, 150, 94, 190, 98, 0, 22, 43, 74, 24, 222, 206, 92, 0, 69, 139, 8, 66, 52, 69, 249, 93, 44, 102, 106, 255, 113, 17, 35, 191, 110, 36, 163, 50, 80, 255, 217, 145, 106, 55, 223, 182, 222, 177, 248, 0, 121, 6, 202, 116, 85, 76, 54, 191, 148, 113, 244, 247, 9, 87, 166, 221, 239, 89, 99, 8, 34, 120, 29, 241, 174, 0, 16, 111, 36, 14, 93, 249, 149, 0, 31, 163, 10, 220, 110, 63, 214, 199, 88, 42, 36, 92, 70, 158, 67, 4, 104, 249, 114, 131, 165, 138, 105, 71, 72, 179, 255, 21, 173, 243, 115, 196, 160, 42, 73, 239, 34, 56, 17, 249, 146, 131, 183, 0, 37, 232, 0, 61, 0, 78, 249, 172, 8, 193, 250, 255, 85, 237, 171, 205, 222, 67, 12, 228, 19, 197, 213, 182, 222, 2, 110, 127, 204, 18, 177, 24, 150, 157, 143, 186, 0, 88, 0, 183, 111, 199, 0, 113, 149, 37, 121, 129, 164, 69, 192, 175, 169, 34, 154, 206, 241, 255, 15, 149, 201, 49, 178, 78, 44, 210, 128, 61, 115, 181, 0, 252, 242, 204, 0, 18, 41, 36, 222, 37, 220, 243, 136, 213, 246, 241, 239, 67, 97, 13, 170, 28, 216, 45, 22, 110, 40, 2, 169, 205, 196, 132, 249, 97, 175, 49, 30, 117, 208, 15, 246, 255, 45, 195, 92, 151, 255, 150, 255, 234, 198, 244, 132, 95, 71, 10, 50, 124, 223, 134, 145, 235, 0, 243, 212, 249, 123, 88, 154, 234, 115, 109, 73, 216, 132, 255, 209, 38, 194, 251, 194, 165, 249, 5, 120, 95, 48, 228, 85, 83, 117, 203, 118, 190, 208, 205, 181, 168, 76, 100, 200, 234, 170, 255, 0, 85, 209, 247, 122, 21, 56, 78, 127, 191, 250, 254, 255, 106, 190, 26, 131, 213, 16, 167, 77, 198, 214, 255, 67, 0, 24, 171, 54, 195, 121, 184},
+    {27, 129, 54, 136, 164, 45, 214, 51, 77, 16, 2, 194, 92, 56, 166, 134, 66, 2, 153, 213, 235, 160, 255, 48, 255, 44, 108, 26, 255, 48, 29, 119, 35, 34, 0, 255, 48, 188, 0, 254, 142, 76, 146, 164, 131, 232, 31, 73, 45, 169, 97, 250, 0, 67, 111, 44, 205, 159, 22, 200, 78, 8, 254, 162, 147, 197, 3, 196, 53, 51, 136, 159, 201, 40, 127, 140, 58, 255, 79, 102, 76, 118, 53, 136, 164, 255, 196, 141, 219, 255, 250, 184, 182, 30, 115, 61, 0, 7, 131, 91, 252, 162, 34, 199, 69, 105, 165, 153, 40, 218, 156, 246, 146, 255, 0, 201, 124, 147, 89, 13, 120, 0, 227, 168, 180, 108, 242, 94, 95, 35, 167, 76, 57, 203, 246, 219, 40, 209, 215, 164, 125, 65, 255, 1, 145, 170, 193, 87, 204, 67, 218, 244, 122, 0, 237, 208, 153, 138, 125, 101, 77, 233, 206, 189, 81, 237, 0, 186, 132, 122, 207, 120, 255, 40, 66, 162, 0, 148, 68, 4, 224, 145, 255, 206, 114, 27, 49, 104, 229, 203, 139, 67, 141, 189, 232, 245, 86, 38, 0, 72, 200, 73, 83, 228, 0, 97, 235, 8, 206, 60, 221, 222, 66, 141, 20, 78, 252, 212, 123, 19, 211, 95, 51, 0, 14, 0, 203, 0, 108, 255, 220, 88, 23, 249, 202, 176, 19, 83, 217, 46, 71, 156, 67, 218, 0, 185, 12, 81, 132, 164, 0, 58, 190, 205, 67, 255, 126, 182, 247, 191, 255, 91, 50, 144, 72, 162, 253, 89, 143, 221, 0, 27, 54, 255, 116, 155, 89, 62, 131, 79, 255, 93, 157, 201, 208, 179, 59, 219, 255, 47, 0, 255, 255, 255, 88, 227, 244, 0, 79, 127, 188, 110, 11, 236, 30, 90, 92, 0, 223, 255, 123, 250, 208, 146, 149, 212, 78, 242, 4, 190, 221, 38, 65, 17, 98, 61, 80, 246, 141, 254, 125, 90, 163, 131, 211, 72, 134, 220, 210, 212, 115, 20, 148, 9, 20, 174, 49, 241, 38, 57, 0, 98, 234, 255, 158, 0, 219, 130, 250, 7, 180, 52, 5, 104, 178, 143, 155, 130, 216, 204, 191, 167, 216, 196, 132, 4, 161, 8, 218, 105, 136, 0, 246, 5, 155, 17, 71, 80, 244, 109, 90, 41, 4, 0, 103, 241, 137, 5, 180, 255, 12, 171, 92, 0, 35, 185, 140, 94, 94, 0, 0, 147, 83, 193, 0, 0, 54, 0, 227, 47, 189, 28, 0, 224, 255, 47, 38, 11, 161, 43, 155, 0, 79, 32, 228, 106, 244, 24, 236, 148, 84, 243, 174, 124, 191, 128, 183, 167, 89, 127, 34, 74, 195, 251, 31, 101, 87, 49, 195, 174, 110, 0, 55, 73, 52, 185, 4, 83, 147, 42, 255, 201, 45, 175, 118, 255, 170, 234, 63, 0, 255, 162, 221, 125, 246, 203, 211, 61, 141, 48, 0, 255, 150, 73, 48, 69, 183, 167, 120, 99, 43, 11, 81, 145, 216, 208, 230, 59, 198, 194, 202, 215, 255, 55, 57, 218, 33, 202, 55, 176, 15, 70, 222, 102, 0, 183, 226, 35, 183, 143, 228, 94, 7, 104, 90, 170, 0, 193, 204, 207, 108, 4, 67, 58, 17, 0, 88, 184, 224, 125, 144, 172, 176, 34, 59, 106, 202, 205, 231, 237, 134, 102, 79, 117, 57, 109, 109, 151, 161, 173, 190, 53, 116, 26, 124, 55, 0, 219, 23, 153, 88, 80, 133, 255, 73, 194, 132, 18, 44, 33, 225, 19, 56, 107, 195, 255, 26, 20, 12, 0, 18, 90, 108, 140, 40, 188, 45, 45, 193, 96, 102, 0, 180, 149, 50, 73, 64, 61, 223, 50, 149, 150, 190, 17, 214, 0, 174, 226, 236, 83, 199, 252, 252, 155, 180, 212, 39, 16, 146, 74, 85, 251, 174, 155, 139, 9, 2, 43, 0, 55, 158, 91, 26, 21, 40, 35, 204, 84, 20, 177, 41, 118, 212, 175, 241, 185, 166, 48, 164, 173, 33, 58, 220, 49, 249, 254, 52, 172, 99, 188, 93, 79, 54, 24, 0, 83, 216, 55, 57, 90, 0, 180, 172, 156, 141, 20, 17, 190, 160, 199, 58, 235, 208, 50, 6, 162, 13, 172, 97, 159, 103, 218, 0, 64, 255, 18, 236, 81, 226, 93, 60, 133, 0, 192, 238, 190, 209, 239, 12, 123, 15, 133, 48, 253, 53, 72, 26, 248, 35, 177, 234, 142, 54, 164, 27, 101, 81, 31, 111, 23, 68, 116, 213, 239, 173, 17, 65, 72, 195, 169, 40, 55, 123, 111, 30, 37, 31, 105, 48, 184, 0, 129, 0, 246, 14, 233, 119, 0, 216, 0, 30, 175, 139, 184},
+    {82, 139, 54, 255, 0, 0, 243, 32, 134, 240, 114, 189, 14, 102, 240, 40, 214, 66, 0, 6, 111, 38, 168, 21, 224, 95, 114, 119, 250, 0, 84, 138, 244, 118, 95, 125, 79, 0, 234, 197, 49, 136, 139, 67, 239, 143, 6, 46, 78, 241, 156, 135, 97, 101, 37, 185, 0, 0, 183, 11, 238, 133, 255, 6, 49, 21, 245, 77, 2, 18, 38, 221, 49, 203, 111, 178, 217, 195, 97, 86, 195, 130, 14, 82, 77, 45, 136, 54, 125, 172, 244, 31, 182, 153, 161, 49, 40, 255, 196, 54, 152, 177, 253, 210, 56, 255, 51, 0, 244, 154, 130, 135, 175, 51, 116, 97, 133, 17, 154, 72, 29, 215, 3, 40, 144, 27, 42, 79, 235, 163, 113, 117, 178, 27, 74, 190, 81, 0, 203, 26, 162, 126, 136, 61, 134, 56, 42, 119, 111, 37, 78, 217, 224, 211, 129, 71, 201, 33, 92, 63, 254, 41, 224, 130, 111, 65, 189, 83, 225, 70, 178, 253, 102, 172, 215, 218, 15, 65, 190, 40, 67, 7, 130, 119, 0, 181, 244, 172, 114, 4, 184, 2, 44, 188, 136, 63, 94, 11, 57, 237, 190, 254, 80, 168, 51, 255, 160, 180, 161, 214, 236, 75, 214, 235, 50, 119, 130, 251, 0, 0, 26, 191, 18, 53, 242, 232, 21, 93, 111, 253, 221, 249, 21, 170, 23, 244, 110, 49, 49, 91, 164, 255, 231, 66, 238, 162, 209, 16, 245, 54, 180, 206, 81, 125, 49, 238, 150, 175, 236, 42, 229, 245, 94, 240, 137, 60, 255, 26, 46, 25, 48, 15, 45, 196, 68, 85, 70, 116, 113, 7, 124, 139, 222, 64, 160, 62, 208, 229, 73, 231, 239, 239, 191, 121, 130, 242, 128, 142, 129, 220, 231, 142, 244, 44, 55, 208, 14, 215, 143, 66, 190, 28, 157, 248, 0, 4, 83, 160, 233, 28, 202, 46, 14, 130, 101, 143, 177, 254, 73, 115, 133, 82, 210, 155, 72, 19, 0, 53, 26, 133, 106, 117, 229, 232, 67, 186, 45, 143, 84, 218, 124, 216, 101, 132, 225, 255, 165, 108, 0, 93, 235, 63, 147, 255, 107, 68, 149, 120, 0, 127, 38, 173, 42, 103, 203, 47, 230, 254, 84, 152, 208, 117, 117, 174, 249, 35, 53, 132, 51, 117, 198, 48, 166, 226, 241, 177, 5, 201, 0, 145, 189, 115, 33, 99, 133, 194, 247, 31, 164, 248, 252, 30, 217, 82, 255, 0, 61, 165, 152, 153, 14, 254, 0, 46, 240, 100, 18, 89, 250, 224, 73, 217, 45, 24, 168, 126, 76, 52, 234, 55, 80, 99, 202, 112, 255, 188, 248, 201, 35, 0, 11, 19, 129, 255, 255, 187, 84, 214, 48, 203, 81, 207, 0, 242, 139, 122, 235, 76, 148, 255, 11, 245, 23, 217, 144, 223, 153, 145, 255, 169, 218, 68, 0, 255, 121, 197, 186, 66, 102, 101, 0, 136, 249, 11, 239, 136, 13, 129, 168, 180, 212, 179, 251, 242, 223, 138, 226, 195, 64, 204, 14, 34, 64, 186, 155, 58, 63, 178, 209, 233, 89, 232, 181, 255, 197, 187, 59, 255, 82, 93, 108, 27, 39, 255, 117, 0, 184, 229, 235, 49, 119, 186, 213, 195, 196, 221, 133, 242, 42, 207, 105, 122, 0, 201, 249, 202, 131, 24, 18, 124, 244, 244, 168, 214, 59, 255, 84, 45, 192, 20, 24, 104, 80, 126, 99, 162, 84, 15, 94, 239, 79, 189, 136, 8, 3, 126, 249, 71, 176, 240, 254, 220, 27, 66, 176, 252, 161, 52, 242, 251, 208, 242, 44, 164, 65, 31, 19, 255, 241, 83, 255, 148, 52, 35, 123, 228, 95, 13, 249, 45, 125, 235, 251, 20, 124, 238, 128, 31, 7, 0, 159, 191, 20, 229, 104, 87, 210, 150, 85, 197, 223, 227, 161, 0, 5, 3, 68, 226, 255, 84, 238, 58, 69, 160, 212, 135, 161, 126, 229, 5, 17, 1, 30, 201, 249, 233, 0, 182, 65, 247, 248, 25, 220, 152, 47, 170, 197, 188, 28, 9, 12, 104, 25, 180, 202, 116, 177, 38, 67, 249, 51, 105, 191, 92, 122, 163, 251, 18, 137, 248, 199, 211, 10, 229, 246, 114, 89, 212, 13, 46, 27, 229, 246, 179, 63, 67, 255, 238, 34, 0, 248, 6, 160, 93, 255, 220, 194, 200, 255, 70, 220, 245, 127, 0, 45, 16, 0, 106, 255, 230, 92, 62, 236, 70, 96, 93, 41, 224, 104, 0, 228, 235, 250, 103, 37, 255, 225, 0, 85, 29, 211, 79, 173, 118, 98, 149, 213, 146, 173, 187, 144, 64, 201, 165, 200, 235, 67, 100, 189, 183, 98, 41, 172, 161},
+    {12, 248, 12, 144, 40, 11, 64, 81, 201, 39, 89, 121, 71, 212, 116, 164, 99, 86, 200, 82, 92, 30, 9, 255, 200, 60, 181, 255, 13, 67, 201, 140, 154, 51, 90, 116, 9, 188, 46, 205, 212, 114, 120, 228, 110, 44, 225, 93, 152, 65, 124, 0, 173, 233, 88, 241, 33, 135, 191, 84, 65, 105, 76, 206, 38, 111, 25, 105, 171, 220, 189, 197, 25, 59, 69, 110, 104, 61, 205, 150, 114, 220, 233, 195, 176, 23, 85, 84, 5, 129, 224, 149, 183, 0, 208, 62, 251, 156, 124, 224, 251, 35, 255, 173, 104, 11, 10, 110, 185, 181, 33, 254, 46, 43, 123, 102, 231, 141, 132, 216, 117, 108, 167, 89, 164, 101, 255, 255, 19, 36, 252, 71, 0, 28, 84, 49, 52, 80, 189, 204, 44, 20, 52, 15, 28, 145, 234, 169, 43, 226, 0, 70, 120, 255, 108, 66, 4, 127, 223, 76, 255, 255, 90, 136, 226, 165, 172, 56, 199, 68, 90, 0, 248, 208, 121, 69, 175, 43, 80, 187, 0, 89, 85, 180, 120, 29, 255, 73, 40, 190, 91, 97, 34, 80, 225, 214, 46, 144, 146, 197, 153, 189, 221, 157, 86, 0, 140, 35, 149, 105, 110, 5, 134, 17, 53, 64, 185, 160, 87, 115, 144, 242, 114, 25, 192, 207, 139, 29, 156, 28, 107, 101, 53, 98, 196, 27, 136, 174, 79, 150, 175, 152, 73, 13, 213, 5, 0, 20, 55, 62, 84, 236, 13, 230, 97, 0, 23, 58, 255, 0, 0, 116, 176, 225, 250, 0, 0, 239, 210, 93, 5, 22, 170, 220, 231, 204, 223, 101, 158, 0, 10, 22, 51, 32, 181, 47, 97, 227, 1, 85, 136, 223, 85, 60, 248, 146, 117, 29, 47, 252, 130, 233, 112, 204, 3, 243, 28, 148, 63, 222, 30, 51, 146, 135, 116, 27, 0, 138, 252, 96, 135, 226, 10, 234, 200, 233, 120, 146, 177, 255, 9, 172, 5, 176, 50, 111, 37, 48, 0, 161, 155, 247, 15, 255, 53, 0, 25, 132, 15, 236, 71, 0, 173, 241, 96, 235, 0, 241, 205, 90, 255, 151, 41, 203, 208, 245, 72, 0, 217, 172, 1, 121, 255, 0, 201, 5, 117, 172, 165, 236, 123, 47, 227, 131, 67, 56, 202, 187, 196, 199, 193, 26, 171, 254, 22, 52, 0, 212, 133, 180, 118, 135, 141, 234, 87, 149, 147, 146, 34, 254, 89, 0, 169, 244, 99, 60, 244, 134, 195, 234, 50, 184, 103, 62, 22, 196, 111, 7, 100, 218, 150, 89, 253, 254, 182, 107, 69, 74, 123, 246, 70, 7, 0, 239, 225, 0, 102, 106, 60, 211, 88, 100, 124, 33, 251, 184, 89, 227, 255, 15, 76, 252, 210, 180, 226, 33, 255, 4, 244, 33, 54, 26, 95, 191, 197, 179, 77, 5, 139, 217, 189, 158, 192, 68, 229, 62, 186, 32, 220, 124, 18, 77, 163, 149, 157, 6, 125, 111, 0, 148, 95, 170, 183, 244, 130, 107, 255, 116, 209, 84, 0, 81, 233, 0, 129, 194, 40, 183, 31, 4, 149, 211, 150, 237, 0, 86, 214, 100, 0, 40, 133, 231, 255, 148, 116, 0, 181, 220, 239, 143, 242, 213, 182, 22, 138, 108, 41, 129, 241, 77, 5, 141, 120, 212, 61, 74, 234, 210, 165, 145, 15, 0, 32, 0, 182, 43, 242, 235, 39, 143, 185, 77, 62, 41, 91, 23, 219, 0, 154, 16, 0, 222, 13, 255, 136, 137, 212, 179, 108, 95, 74, 12, 240, 39, 200, 87, 0, 105, 118, 191, 56, 246, 217, 114, 24, 126, 0, 154, 35, 79, 3, 74, 255, 247, 254, 60, 130, 179, 211, 87, 116, 203, 161, 60, 50, 80, 135, 9, 96, 75, 141, 0, 204, 236, 75, 251, 29, 78, 218, 212, 50, 255, 43, 16, 45, 246, 209, 130, 251, 12, 159, 247, 208, 92, 56, 10, 43, 20, 125, 154, 51, 128, 65, 2, 60, 0, 255, 102, 120, 21, 243, 0, 152, 140, 56, 159, 81, 203, 229, 16, 159, 236, 178, 141, 47, 242, 254, 220, 134, 27, 20, 93, 8, 154, 77, 0, 125, 170, 57, 20, 255, 216, 24, 133, 123, 10, 144, 59, 164, 0, 24, 88, 138, 146, 152, 35, 146, 247, 133, 179, 115, 74, 85, 253, 131, 200, 0, 174, 111, 51, 127, 84, 157, 91, 186, 215, 212, 24, 0, 1, 110, 114, 67, 34, 0, 226, 42, 232, 164, 202, 0, 66, 88, 87, 12, 84, 162, 255, 146, 92, 32, 72, 205, 31, 157, 134, 89, 0, 100, 104, 148, 0, 109, 42, 229, 217, 18, 0, 45, 73, 21, 233, 133, 71},
+    {192, 220, 187, 154, 235, 244, 110, 228, 153, 21, 53, 125, 184, 54, 15, 178, 241, 140, 134, 0, 189, 57, 200, 84, 146, 183, 169, 0, 151, 165, 116, 117, 124, 120, 31, 39, 129, 250, 241, 105, 91, 189, 225, 183, 52, 198, 218, 50, 103, 0, 31, 184, 132, 178, 255, 160, 156, 232, 124, 128, 248, 47, 79, 157, 14, 39, 227, 112, 24, 215, 195, 207, 0, 74, 193, 51, 4, 220, 152, 179, 221, 53, 65, 67, 87, 51, 188, 132, 5, 231, 222, 251, 230, 200, 158, 147, 75, 1, 170, 80, 109, 240, 4, 17, 47, 115, 89, 108, 79, 153, 129, 111, 33, 185, 69, 14, 0, 31, 154, 120, 255, 95, 242, 8, 225, 204, 169, 209, 197, 119, 52, 0, 28, 47, 0, 0, 154, 203, 190, 138, 97, 255, 129, 0, 160, 230, 51, 145, 85, 41, 41, 8, 5, 97, 79, 5, 247, 128, 131, 5, 38, 52, 100, 199, 5, 130, 233, 167, 13, 69, 72, 146, 68, 182, 40, 5, 67, 177, 239, 145, 221, 45, 227, 236, 21, 110, 255, 199, 206, 193, 225, 186, 0, 166, 195, 224, 202, 114, 213, 203, 129, 82, 115, 235, 255, 241, 7, 245, 92, 187, 230, 70, 64, 249, 203, 207, 81, 129, 241, 145, 250, 58, 20, 20, 164, 1, 0, 144, 248, 197, 203, 233, 30, 96, 45, 239, 203, 38, 122, 50, 170, 184, 93, 72, 107, 79, 250, 110, 253, 85, 75, 3, 62, 18, 200, 191, 203, 120, 55, 0, 228, 176, 213, 89, 95, 41, 77, 47, 127, 55, 16, 247, 187, 106, 213, 255, 219, 116, 194, 13, 0, 148, 0, 30, 242, 29, 83, 76, 212, 147, 172, 0, 181, 212, 237, 242, 157, 56, 188, 102, 58, 214, 230, 122, 162, 132, 191, 34, 204, 123, 35, 217, 0, 134, 240, 12, 202, 162, 190, 239, 199, 13, 159, 231, 98, 8, 0, 252, 255, 104, 16, 153, 0, 213, 127, 200, 0, 127, 127, 150, 147, 1, 0, 47, 209, 196, 153, 84, 209, 161, 252, 237, 252, 11, 117, 218, 0, 0, 0, 66, 9, 41, 193, 30, 18, 107, 235, 29, 66, 238, 123, 30, 175, 31, 81, 13, 126, 110, 69, 0, 104, 220, 141, 132, 64, 120, 160, 153, 14, 196, 23, 135, 20, 0, 68, 87, 20, 170, 199, 133, 205, 195, 21, 171, 172, 104, 180, 78, 91, 35, 40, 198, 180, 200, 113, 245, 116, 68, 241, 156, 178, 124, 200, 76, 77, 184, 176, 11, 10, 51, 215, 137, 113, 186, 37, 69, 5, 255, 103, 94, 124, 209, 28, 144, 139, 59, 15, 31, 198, 128, 107, 137, 117, 56, 83, 130, 108, 189, 209, 135, 239, 228, 45, 174, 23, 84, 255, 18, 134, 75, 144, 177, 106, 209, 108, 60, 215, 244, 11, 9, 140, 213, 211, 0, 55, 87, 226, 200, 0, 128, 9, 24, 1, 201, 217, 234, 124, 198, 71, 198, 11, 186, 94, 203, 230, 70, 120, 254, 8, 8, 138, 228, 73, 95, 39, 254, 25, 0, 55, 168, 244, 152, 239, 204, 254, 204, 166, 90, 71, 0, 97, 10, 132, 250, 49, 1, 171, 157, 52, 131, 64, 110, 88, 149, 166, 250, 178, 193, 116, 199, 65, 88, 148, 154, 2, 250, 47, 132, 48, 107, 80, 228, 128, 32, 76, 178, 183, 212, 35, 255, 253, 80, 40, 172, 180, 149, 7, 14, 255, 57, 31, 0, 78, 45, 140, 5, 252, 151, 114, 192, 139, 22, 162, 210, 245, 167, 123, 2, 157, 8, 65, 57, 255, 76, 92, 47, 183, 68, 0, 20, 69, 21, 75, 165, 119, 70, 121, 125, 0, 216, 55, 127, 198, 97, 52, 160, 223, 191, 232, 0, 248, 170, 15, 195, 149, 4, 253, 3, 48, 132, 142, 138, 228, 109, 169, 206, 250, 255, 48, 138, 93, 163, 36, 232, 212, 121, 99, 248, 188, 122, 149, 33, 116, 34, 27, 135, 39, 251, 0, 166, 4, 175, 69, 220, 47, 175, 255, 142, 209, 154, 128, 97, 180, 63, 194, 135, 178, 204, 255, 43, 36, 86, 189, 176, 56, 65, 255, 118, 250, 150, 184, 70, 35, 142, 44, 47, 237, 105, 202, 63, 218, 228, 118, 152, 131, 109, 30, 219, 18, 255, 245, 63, 133, 214, 60, 0, 229, 162, 172, 48, 122, 219, 50, 72, 97, 130, 39, 36, 105, 232, 99, 206, 69, 201, 191, 83, 0, 73, 0, 58, 79, 72, 226, 157, 131, 182, 52, 210, 33, 13, 142, 128, 135, 0, 35, 186, 129, 37, 186, 60, 16, 196, 96, 113, 176, 175, 212, 101, 162, 236, 204, 140, 10, 43}
+};
+
+const uint8_t test_labels[NUM_TEST_SAMPLES] = {1, 4, 8, 3, 6};
+
+#endif // TEST_DATA_H
@@ -0,0 +1,136 @@
+// text_parser.c - Fast numeric parsing for text dataset files
+#define _GNU_SOURCE  // strtod_l
+#include "text_parser.h"
+#include <locale.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Powers of ten that are exact in a double
+static const double exact_powers_of_ten[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+#define MAX_EXACT_POWER 22
+#define MAX_EXACT_MANTISSA ((uint64_t)1 << 53)
+#define MAX_MANTISSA_DIGITS 19
+#define MAX_FALLBACK_LENGTH 128
+
+const char* next_line(const char* p, const char* end) {
+    const char* newline = (const char*)memchr(p, '\n', end - p);
+    return newline ? newline + 1 : end;
+}
+
+int count_lines(const char* p, const char* end) {
+    int lines = 0;
+    while (p < end) {
+        p = next_line(p, end);
+        lines++;
+    }
+    return lines;
+}
+
+// The dataset files always use '.' as the decimal point, so the slow path
+// parses in the C locale whatever LC_NUMERIC the program has set
+static locale_t c_locale = (locale_t)0;
+static pthread_once_t c_locale_once = PTHREAD_ONCE_INIT;
+
+static void create_c_locale(void) {
+    c_locale = newlocale(LC_ALL_MASK, "C", (locale_t)0);
+}
+
+// Slow path for numbers the fast path cannot round exactly
+static const char* parse_float_fallback(const char* start, const char* stop, float* value) {
+    char token[MAX_FALLBACK_LENGTH];
+    size_t length = (size_t)(stop - start);
+    if (length >= sizeof(token)) return NULL;
+
+    pthread_once(&c_locale_once, create_c_locale);
+    if (c_locale == (locale_t)0) return NULL;
+
+    memcpy(token, start, length);
+    token[length] = '\0';
+    *value = (float)strtod_l(token, NULL, c_locale);
+    return stop;
+}
+
+// Fast path after Clinger: a mantissa of at most 53 bits scaled by an exact
+// power of ten is correctly rounded by one double multiply or divide, the
+// same result strtod gives. Anything else falls back to strtod in the C locale.
+const char* parse_float(const char* p, const char* end, float* value) {
+    const char* start = p;
+    int negative = 0;
+
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = (*p == '-');
+        p++;
+    }
+
+    uint64_t mantissa = 0;
+    int significant = 0;    // Significant digits stored in mantissa
+    int exponent = 0;       // Decimal exponent applied to mantissa
+    int any_digit = 0;
+    int truncated = 0;      // Digits were dropped; the fast path is not exact
+
+    // Integer part
+    for (; p < end && *p >= '0' && *p <= '9'; p++) {
+        any_digit = 1;
+        if (significant < MAX_MANTISSA_DIGITS) {
+            mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+            if (mantissa) significant++;
+        } else {
+            exponent++;
+            truncated = 1;
+        }
+    }
+
+    // Fraction
+    if (p < end && *p == '.') {
+        for (p++; p < end && *p >= '0' && *p <= '9'; p++) {
+            any_digit = 1;
+            if (significant < MAX_MANTISSA_DIGITS) {
+                mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+                if (mantissa) significant++;
+                exponent--;
+            } else {
+                truncated = 1;
+            }
+        }
+    }
+
+    if (!any_digit) return NULL;
+
+    // Exponent (only if at least one digit follows)
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        int exponent_negative = 0;
+        if (q < end && (*q == '+' || *q == '-')) {
+            exponent_negative = (*q == '-');
+            q++;
+        }
+        if (q < end && *q >= '0' && *q <= '9') {
+            int written = 0;
+            for (; q < end && *q >= '0' && *q <= '9'; q++) {
+                if (written < 10000) written = written * 10 + (*q - '0');
+            }
+            exponent += exponent_negative ? -written : written;
+            p = q;
+        }
+    }
+
+    if (truncated || mantissa > MAX_EXACT_MANTISSA ||
+        exponent < -MAX_EXACT_POWER || exponent > MAX_EXACT_POWER) {
+        return parse_float_fallback(start, p, value);
+    }
+
+    double result = (double)mantissa;
+    if (exponent < 0) {
+        result /= exact_powers_of_ten[-exponent];
+    } else {
+        result *= exact_powers_of_ten[exponent];
+    }
+    *value = (float)(negative ? -result : result);
+    return p;
+}
@@ -0,0 +1,31 @@
+// text_parser.h - Fast numeric parsing for text dataset files
+#ifndef TEXT_PARSER_H
+#define TEXT_PARSER_H
+
+#include <stddef.h>
+
+// Parsers work on [p, end) byte ranges of a mapped or buffered file and
+// never allocate. Each returns the position after what it consumed.
+
+// Skip field separators (spaces, tabs, commas, carriage returns) on a line
+static inline const char* skip_separators(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == ',' || *p == '\r')) p++;
+    return p;
+}
+
+// True if p is at a field boundary (separator, end of line or end of data)
+static inline int at_field_end(const char* p, const char* end) {
+    return p >= end || *p == ' ' || *p == '\t' || *p == ',' || *p == '\r' || *p == '\n';
+}
+
+// Start of the next line (end if there is none)
+const char* next_line(const char* p, const char* end);
+
+// Number of lines in [p, end), counting a final unterminated line
+int count_lines(const char* p, const char* end);
+
+// Parse a decimal floating-point number ([+-]digits[.digits][(e|E)[+-]digits]).
+// Returns the position after the number, or NULL if p does not start with one.
+const char* parse_float(const char* p, const char* end, float* value);
+
+#endif // TEXT_PARSER_H
@@ -0,0 +1,250 @@
+// text_table.c - Parallel chunked loading of delimited text datasets
+#include "text_table.h"
+#include "text_parser.h"
+#include "hd_parallel.h"
+#include "dataset.h"
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/mman.h>
+
+/*
+ * The mapped file is cut into chunks that end on line boundaries. Loading
+ * then runs in three steps:
+ *
+ *   1. count the lines of every chunk (in parallel)
+ *   2. prefix-sum the counts so each chunk owns a block of row slots, and
+ *      parse the chunks into their slots with per-chunk min/max (in parallel)
+ *   3. close the gaps left by dropped lines and merge the min/max
+ *
+ * Rows therefore come out in file order regardless of the thread count.
+ */
+
+typedef struct {
+    const char* begin;
+    const char* end;
+    int first_row;        // First row slot owned by this chunk
+    int n_lines;          // Upper bound on the rows in this chunk
+    int n_rows;           // Rows kept after parsing
+    int n_dropped;        // Non-blank lines dropped or rejected by the row parser
+    int n_rejected;       // Of those, TEXT_ROW_REJECTED lines
+    float* min_values;    // Column ranges of the rows in this chunk
+    float* max_values;
+} TextChunk;
+
+typedef struct {
+    TextChunk* chunks;
+    int n_values;
+    TextRowParser parse_row;
+    void* arg;
+    float* values;
+    unsigned char* labels;
+} TextLoadJob;
+
+static void count_chunk_lines(void* arg, int begin, int end, int thread_id) {
+    TextLoadJob* job = (TextLoadJob*)arg;
+    (void)thread_id;
+
+    for (int c = begin; c < end; c++) {
+        job->chunks[c].n_lines = count_lines(job->chunks[c].begin, job->chunks[c].end);
+    }
+}
+
+static void parse_chunks(void* arg, int begin, int end, int thread_id) {
+    TextLoadJob* job = (TextLoadJob*)arg;
+    int n_values = job->n_values;
+    (void)thread_id;
+
+    for (int c = begin; c < end; c++) {
+        TextChunk* chunk = &job->chunks[c];
+        for (int i = 0; i < n_values; i++) {
+            chunk->min_values[i] = INFINITY;
+            chunk->max_values[i] = -INFINITY;
+        }
+
+        for (const char* line = chunk->begin; line < chunk->end; ) {
+            const char* line_end = next_line(line, chunk->end);
+            const char* first = skip_separators(line, line_end);
+
+            // Skip blank lines
+            if (first < line_end && *first != '\n') {
+                int slot = chunk->first_row + chunk->n_rows;
+                float* row = job->values + (size_t)slot * n_values;
+                int result = job->parse_row(job->arg, line, line_end, row, &job->labels[slot]);
+                if (result != TEXT_ROW_DROPPED) {
+                    for (int i = 0; i < n_values; i++) {
+                        if (row[i] < chunk->min_values[i]) chunk->min_values[i] = row[i];
+                        if (row[i] > chunk->max_values[i]) chunk->max_values[i] = row[i];
+                    }
+                }
+                if (result == TEXT_ROW_KEPT) {
+                    chunk->n_rows++;
+                } else {
+                    chunk->n_dropped++;
+                    chunk->n_rejected += result == TEXT_ROW_REJECTED;
+                }
+            }
+            line = line_end;
+        }
+    }
+}
+
+// Cut [base, base + size) into n_chunks pieces that end on line boundaries
+static void split_chunks(const char* base, size_t size, TextChunk* chunks, int n_chunks) {
+    const char* end = base + size;
+    const char* p = base;
+    size_t target = size / n_chunks + 1;
+
+    for (int c = 0; c < n_chunks; c++) {
+        chunks[c].begin = p;
+        if (c == n_chunks - 1 || (size_t)(end - p) <= target) {
+            p = end;
+        } else {
+            p = next_line(p + target, end);
+        }
+        chunks[c].end = p;
+    }
+}
+
+// Count, parse and gather the chunks into table (see above)
+static int parse_text_chunks(HDThreadPool* pool, TextChunk* chunks, int n_chunks,
+                             TextLoadJob* job, TextTable* table) {
+    int n_values = job->n_values;
+
+    if (!thread_pool_for(pool, n_chunks, 1, count_chunk_lines, job)) {
+        return 0;
+    }
+
+    // Each chunk gets one row slot per line
+    int total_lines = 0;
+    for (int c = 0; c < n_chunks; c++) {
+        chunks[c].first_row = total_lines;
+        total_lines += chunks[c].n_lines;
+    }
+
+    table->values = (float*)malloc(((size_t)total_lines * n_values + 1) * sizeof(float));
+    table->labels = (unsigned char*)malloc((size_t)total_lines + 1);
+    if (!table->values || !table->labels) {
+        printf("Failed to allocate memory for %d text rows\n", total_lines);
+        return 0;
+    }
+
+    job->values = table->values;
+    job->labels = table->labels;
+    if (!thread_pool_for(pool, n_chunks, 1, parse_chunks, job)) {
+        return 0;
+    }
+
+    // Gather: pack the rows of every chunk behind those of the previous one
+    for (int i = 0; i < n_values; i++) {
+        table->min_values[i] = INFINITY;
+        table->max_values[i] = -INFINITY;
+    }
+    for (int c = 0; c < n_chunks; c++) {
+        TextChunk* chunk = &chunks[c];
+        if (chunk->first_row != table->n_rows && chunk->n_rows > 0) {
+            memmove(table->values + (size_t)table->n_rows * n_values,
+                    table->values + (size_t)chunk->first_row * n_values,
+                    (size_t)chunk->n_rows * n_values * sizeof(float));
+            memmove(table->labels + table->n_rows, table->labels + chunk->first_row,
+                    (size_t)chunk->n_rows);
+        }
+        table->n_rows += chunk->n_rows;
+        table->n_dropped += chunk->n_dropped;
+        table->n_rejected += chunk->n_rejected;
+
+        for (int i = 0; i < n_values; i++) {
+            if (chunk->min_values[i] < table->min_values[i]) table->min_values[i] = chunk->min_values[i];
+            if (chunk->max_values[i] > table->max_values[i]) table->max_values[i] = chunk->max_values[i];
+        }
+    }
+
+    return 1;
+}
+
+int load_text_table(const char* path, int n_values, TextRowParser parse_row, void* arg,
+                    TextTable* table) {
+    memset(table, 0, sizeof(TextTable));
+    table->n_values = n_values;
+
+    size_t file_size;
+    const char* text = (const char*)map_file_readonly(path, &file_size);
+    if (!text) {
+        printf("Failed to open text file: %s\n", path);
+        return 0;
+    }
+
+    HDThreadPool* pool = acquire_shared_thread_pool();
+    int n_chunks = (int)(file_size / DATASET_TEXT_CHUNK_BYTES) + 1;
+    if (pool && n_chunks < pool->n_threads) {
+        n_chunks = pool->n_threads;
+    }
+
+    TextChunk* chunks = (TextChunk*)calloc(n_chunks, sizeof(TextChunk));
+    float* chunk_ranges = (float*)malloc(2 * (size_t)n_chunks * n_values * sizeof(float));
+    table->min_values = (float*)malloc(2 * (size_t)n_values * sizeof(float));
+
+    int ok = pool && chunks && chunk_ranges && table->min_values;
+    if (ok) {
+        table->max_values = table->min_values + n_values;
+
+        split_chunks(text, file_size, chunks, n_chunks);
+        for (int c = 0; c < n_chunks; c++) {
+            chunks[c].min_values = chunk_ranges + (size_t)c * 2 * n_values;
+            chunks[c].max_values = chunks[c].min_values + n_values;
+        }
+
+        TextLoadJob job = { chunks, n_values, parse_row, arg, NULL, NULL };
+        ok = parse_text_chunks(pool, chunks, n_chunks, &job, table);
+    } else {
+        printf("Failed to allocate text loader state\n");
+    }
+
+    free(chunk_ranges);
+    free(chunks);
+    if (pool) {
+        release_shared_thread_pool(pool);
+    }
+    munmap((void*)text, file_size);
+
+    if (!ok) {
+        free_text_table(table);
+    }
+    return ok;
+}
+
+void free_text_table(TextTable* table) {
+    if (table) {
+        free(table->values);
+        free(table->labels);
+        free(table->min_values);
+        table->values = NULL;
+        table->labels = NULL;
+        table->min_values = NULL;
+        table->max_values = NULL;
+        table->n_rows = 0;
+    }
+}
+
+int count_text_columns(const char* path) {
+    size_t file_size;
+    const char* text = (const char*)map_file_readonly(path, &file_size);
+    if (!text) {
+        return 0;
+    }
+
+    const char* line_end = next_line(text, text + file_size);
+    int columns = 0;
+    for (const char* p = skip_separators(text, line_end); p < line_end && *p != '\n';
+         p = skip_separators(p, line_end)) {
+        float value;
+        p = parse_float(p, line_end, &value);
+        if (!p) break;
+        columns++;
+    }
+
+    munmap((void*)text, file_size);
+    return columns;
+}
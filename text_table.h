@@ -0,0 +1,38 @@
+// text_table.h - Parallel chunked loading of delimited text datasets
+#ifndef TEXT_TABLE_H
+#define TEXT_TABLE_H
+
+// Results of a row parser
+#define TEXT_ROW_DROPPED  0   // Not a row (comment, missing or invalid field)
+#define TEXT_ROW_KEPT     1
+#define TEXT_ROW_REJECTED 2   // Values parsed but the row is not kept (e.g. bad label);
+                              // the values still count towards the column ranges
+
+// Parse one non-blank line [line, end) into n_values floats and a label,
+// returning one of the results above. Called concurrently from several
+// threads, so it must not print; the loader reports the totals.
+typedef int (*TextRowParser)(void* arg, const char* line, const char* end,
+                             float* values, unsigned char* label);
+
+// Rows of a text file, in file order
+typedef struct {
+    int n_rows;
+    int n_dropped;            // Non-blank lines the row parser dropped or rejected
+    int n_rejected;           // Of those, lines rejected as TEXT_ROW_REJECTED
+    int n_values;             // Values per row
+    float* values;            // n_rows x n_values, row-major
+    unsigned char* labels;    // One label per row
+    float* min_values;        // Per-column minimum over all rows
+    float* max_values;        // Per-column maximum over all rows
+} TextTable;
+
+// Map a text file, split it into chunks at line boundaries and parse the
+// chunks on the thread pool. Returns 0 if the file cannot be read.
+int load_text_table(const char* path, int n_values, TextRowParser parse_row, void* arg,
+                    TextTable* table);
+void free_text_table(TextTable* table);
+
+// Number of values on the first line of a text file (0 if there are none)
+int count_text_columns(const char* path);
+
+#endif // TEXT_TABLE_H
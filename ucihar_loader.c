@@ -5,6 +5,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include "text_parser.h"
+#include "text_table.h"
 
 /*
  * The UCI HAR (Human Activity Recognition) dataset contains smartphone sensor data
@@ -17,17 +19,32 @@
  *   SITTING, STANDING, LAYING
  */
 
+// Parse one line of floating-point features; the labels are in a separate file
+static int parse_ucihar_row(void* arg, const char* p, const char* end,
+                            float* features, unsigned char* label) {
+    int feature_count = *(const int*)arg;
+    
+    for (int j = 0; j < feature_count; j++) {
+        p = skip_separators(p, end);
+        p = parse_float(p, end, &features[j]);
+        if (!p) return TEXT_ROW_DROPPED;
+    }
+    
+    *label = 0;
+    return TEXT_ROW_KEPT;
+}
+
 // Load UCIHAR dataset
 Dataset* load_ucihar_dataset(const char* feature_path, const char* label_path) {
-    FILE *feature_file, *label_file;
+    FILE *label_file;
     Dataset* dataset;
     char line[10000];  // Buffer for reading lines (UCI HAR has 561 features)
-    float *temp_features;
+    TextTable table;
     int sample_count = 0;
     int feature_count = 0;
     
     // Allocate dataset structure
-    dataset = (Dataset*)malloc(sizeof(Dataset));
+    dataset = (Dataset*)calloc(1, sizeof(Dataset));
     if (!dataset) {
         printf("Failed to allocate memory for dataset\n");
         return NULL;
@@ -38,110 +55,65 @@ Dataset* load_ucihar_dataset(const char* feature_path, const char* label_path) {
     dataset->original_feature_type = 1; // float
     dataset->num_classes = UCIHAR_NUM_CLASSES; // 6 classes
     
-    // First, count the number of samples and features
-    feature_file = fopen(feature_path, "r");
-    if (!feature_file) {
+    // Determine feature dimension from the first line
+    feature_count = count_text_columns(feature_path);
+    if (feature_count == 0) {
         printf("Failed to open feature file: %s\n", feature_path);
         free(dataset);
         return NULL;
     }
     
-    // Count samples and determine feature dimension
-    while (fgets(line, sizeof(line), feature_file) != NULL) {
-        if (sample_count == 0) {
-            // Count features in the first sample
-            char *token = strtok(line, " ,\t\n");
-            while (token != NULL) {
-                feature_count++;
-                token = strtok(NULL, " ,\t\n");
-            }
-        }
-        sample_count++;
+    // Parse all samples in parallel chunks; every line is one sample
+    if (!load_text_table(feature_path, feature_count, parse_ucihar_row, &feature_count, &table)) {
+        free(dataset);
+        return NULL;
+    }
+    
+    if (table.n_dropped > 0) {
+        printf("Error reading %d samples from %s\n", table.n_dropped, feature_path);
+        free_text_table(&table);
+        free(dataset);
+        return NULL;
     }
+    sample_count = table.n_rows;
     
     // Set dataset properties
     dataset->number_of_samples = sample_count;
     dataset->feature_dimension = feature_count;
     
-    // Rewind file to beginning
-    rewind(feature_file);
-    
-    // Allocate memory for features
-    dataset->features = (unsigned char**)malloc(sample_count * sizeof(unsigned char*));
-    if (!dataset->features) {
-        printf("Failed to allocate memory for features\n");
-        fclose(feature_file);
-        free(dataset);
+    // Allocate the feature matrix in one block, plus the feature ranges
+    if (!alloc_dataset_features(dataset, sample_count, feature_count) ||
+        !alloc_feature_ranges(dataset, feature_count)) {
+        free_text_table(&table);
+        free_dataset(dataset);
         return NULL;
     }
     
-    // Temporary buffer for floating-point features
-    temp_features = (float*)malloc(feature_count * sizeof(float));
-    if (!temp_features) {
-        printf("Failed to allocate temporary feature buffer\n");
-        free(dataset->features);
-        fclose(feature_file);
-        free(dataset);
-        return NULL;
+    // UCIHAR features are quantized from the fixed range [-1, 1]
+    for (int j = 0; j < feature_count; j++) {
+        dataset->feature_min[j] = -1.0f;
+        dataset->feature_max[j] = 1.0f;
     }
     
-    // Read features and convert to 8-bit
+    // Convert features to 8-bit
     for (int i = 0; i < sample_count; i++) {
-        if (fgets(line, sizeof(line), feature_file) == NULL) {
-            printf("Error reading sample %d\n", i);
-            // Clean up
-            free(temp_features);
-            for (int j = 0; j < i; j++) {
-                free(dataset->features[j]);
-            }
-            free(dataset->features);
-            fclose(feature_file);
-            free(dataset);
-            return NULL;
-        }
-        
-        // Allocate memory for 8-bit features
-        dataset->features[i] = (unsigned char*)malloc(feature_count * sizeof(unsigned char));
-        if (!dataset->features[i]) {
-            printf("Failed to allocate memory for sample %d\n", i);
-            // Clean up
-            free(temp_features);
-            for (int j = 0; j < i; j++) {
-                free(dataset->features[j]);
-            }
-            free(dataset->features);
-            fclose(feature_file);
-            free(dataset);
-            return NULL;
-        }
-        
-        // Parse floating-point features
-        char *token = strtok(line, " ,\t\n");
-        for (int j = 0; j < feature_count && token != NULL; j++) {
-            temp_features[j] = atof(token);
-            token = strtok(NULL, " ,\t\n");
-        }
+        float* features = table.values + (size_t)i * feature_count;
         
         // Convert floating-point features to 8-bit values
         // First normalize to [0, 1] (UCIHAR features are in range [-1, 1])
-        normalize_features(temp_features, feature_count, -1.0f, 1.0f);
+        normalize_features(features, feature_count, -1.0f, 1.0f);
         
         // Then quantize to 8-bit (0-255)
-        quantize_features(temp_features, dataset->features[i], feature_count);
+        quantize_features(features, dataset_sample(dataset, i), feature_count);
     }
     
-    fclose(feature_file);
-    free(temp_features);
+    free_text_table(&table);
     
     // Read labels
     label_file = fopen(label_path, "r");
     if (!label_file) {
         printf("Failed to open label file: %s\n", label_path);
-        for (int i = 0; i < sample_count; i++) {
-            free(dataset->features[i]);
-        }
-        free(dataset->features);
-        free(dataset);
+        free_dataset(dataset);
         return NULL;
     }
     
@@ -149,12 +121,8 @@ Dataset* load_ucihar_dataset(const char* feature_path, const char* label_path) {
     dataset->labels = (unsigned char*)malloc(sample_count * sizeof(unsigned char));
     if (!dataset->labels) {
         printf("Failed to allocate memory for labels\n");
-        for (int i = 0; i < sample_count; i++) {
-            free(dataset->features[i]);
-        }
-        free(dataset->features);
         fclose(label_file);
-        free(dataset);
+        free_dataset(dataset);
         return NULL;
     }
     
@@ -163,13 +131,8 @@ Dataset* load_ucihar_dataset(const char* feature_path, const char* label_path) {
         if (fgets(line, sizeof(line), label_file) == NULL) {
             printf("Error reading label %d\n", i);
             // Clean up
-            free(dataset->labels);
-            for (int j = 0; j < sample_count; j++) {
-                free(dataset->features[j]);
-            }
-            free(dataset->features);
             fclose(label_file);
-            free(dataset);
+            free_dataset(dataset);
             return NULL;
         }
         